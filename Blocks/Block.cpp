@@ -2,4 +2,7 @@
 // Created by sdalp on 12/7/2025.
 //
 
-#include "Block.h"
\ No newline at end of file
+#include "Block.h"
+
+// Compile the standard board's block here once
+template class BasicBlock<GameGrid>;
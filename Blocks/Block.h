@@ -7,169 +7,94 @@
 #include <array>
 
 #include "enums.h"
+#include "PieceTables.h"
+#include "RotationSystem.h"
 #include "GameManager/GameGrid.h"
 
 
-class Block {
-    Point centerPosition;
-    std::array<Point, 4> blockPositions{};
+// A falling piece on a Grid (any BasicGameGrid), use Block for the standard board
+template <typename Grid>
+class BasicBlock {
+    // top-left corner of the piece's bounding box
+    Point position;
+    BlockType type;
     BlockColor color;
-    GameGrid* gameGrid;
+    Grid* gameGrid;
+    const RotationSystem* rotationSystem;
 
     int rotation = 0;
 
 
     // Helper method to check if all positions of the block are valid
-    [[nodiscard]] bool areAllPositionsValid(const Point& testCenterPos) const {
-        for (int i = 0; i < 4; i++) {
-            Point testPos{};
-            testPos.x = testCenterPos.x + blockPositions[i].x;
-            testPos.y = testCenterPos.y + blockPositions[i].y;
-
-            if (!gameGrid->isValidPosition(testPos)) {
-                return false;
-            }
-        }
-        return true;
+    [[nodiscard]] bool areAllPositionsValid(const Point& testPos) const {
+        return gameGrid->fits(pieceShape(type, rotation), testPos);
     }
 
-    // Helper to validate with custom positions (for rotation testing)
-    [[nodiscard]] bool areAllPositionsValidWithCustom(
-        const Point& testCenterPos,
-        const std::array<Point, 4>& testPositions
-    ) const {
-        for (int i = 0; i < 4; i++) {
-            Point testPos{};
-            testPos.x = testCenterPos.x + testPositions[i].x;
-            testPos.y = testCenterPos.y + testPositions[i].y;
-
-            if (! gameGrid->isValidPosition(testPos)) {
-                return false;
-            }
+    // Turns the block through the rotation system's kick table
+    MoveResult rotate(const RotationDirection direction) {
+        if (rotationSystem->tryRotate(*gameGrid, type, rotation, position, direction)) {
+            return MoveResult::MOVED;
         }
-        return true;
-    }
 
-    void rotateBlock() {
-        // 90-degree clockwise rotation formula:
-        // new_x = old_y
-        // new_y = -old_x
-
-        for (auto& pos : blockPositions) {
-            const int oldX = pos.x;
-            const int oldY = pos.y;
-
-            pos.x = oldY;
-            pos.y = -oldX;
-        }
+        // Rotation failed
+        return MoveResult::BLOCKED;
     }
 
 
 public:
-    explicit Block(
+    explicit BasicBlock(
         const Point initPosition,
         const BlockType blockOption,
         const BlockColor blockColor,
-        GameGrid* gameGrid
+        Grid* gameGrid,
+        const RotationSystem* rotationSystem = &RotationSystems::SRS
         ):
-    centerPosition(initPosition),
+    position(initPosition),
+    type(blockOption),
     color(blockColor),
-    gameGrid(gameGrid)
+    gameGrid(gameGrid),
+    rotationSystem(rotationSystem)
     {
-        // center position is always 2
-
-        this->blockPositions[2].y = 0;
-        this->blockPositions[2].x = 0;
-
-        switch (blockOption) {
-            // line block
-            case BlockType::I:
-                // Left side
-                blockPositions[0].y = 0;
-                blockPositions[0].x = -2;
-
-
-                blockPositions[1].y = 0;
-                blockPositions[1].x = -1;
-
-
-                blockPositions[3].y = 0;
-                blockPositions[3].x = 1;
-                break;
-            // Square
-            case BlockType::O:
-                // up 1
-                blockPositions[0].y = -1;
-                blockPositions[0].x = 0;
-
-                // up & right 1
-                blockPositions[1].y = 1;
-                blockPositions[1].x = 1;
-
-                // right 1
-                blockPositions[3].y = 0;
-                blockPositions[3].x = 1;
-                break;
-            // T shaped
-            case BlockType::T:
-                // up 1
-                blockPositions[0].y = -1;
-                blockPositions[0].x = 0;
-
-                blockPositions[1].y = 0;
-                blockPositions[1].x = -1;
-
-                blockPositions[3].y = 0;
-                blockPositions[3].x = 1;
-                break;
-
-            case BlockType::Z:
-                blockPositions[0].y = -1;
-                blockPositions[0].x = -1;
-
-                blockPositions[1].y = -1;
-                blockPositions[1].x = 0;
-
-                blockPositions[3].y = 0;
-                blockPositions[3].x = 1;
-                break;
-
-            case BlockType::J:
-                blockPositions[0].y = -2;
-                blockPositions[0].x = 0;
+    }
 
-                blockPositions[1].y = -1;
-                blockPositions[1].x = 0;
+    void setPosition(const Point newPosition) {
+        this->position = newPosition;
+    };
 
-                blockPositions[3].y = 0;
-                blockPositions[3].x = -1;
-                break;
+    [[nodiscard]] Point getPosition() const {
+        return this->position;
+    }
 
-            case BlockType::L:
-                blockPositions[0].y = -2;
-                blockPositions[0].x = 0;
+    [[nodiscard]] BlockType getType() const {
+        return this->type;
+    }
 
-                blockPositions[1].y = -1;
-                blockPositions[1]. x = 0;
+    // Turns the block straight into rotation, no kicks and no checks
+    void setRotation(const int newRotation) {
+        this->rotation = newRotation & (ROTATION_COUNT - 1);
+    }
 
-                blockPositions[3].y = 0;
-                blockPositions[3].x = 1;
-                break;
+    [[nodiscard]] int getRotation() const {
+        return this->rotation;
+    }
 
-            default: ;
-        }
+    // The grid row of the block's lowest cell, which unlike the box's y doesn't move when it rotates in place
+    [[nodiscard]] int bottomRow() const {
+        return position.y + pieceShape(type, rotation).maxY;
     }
 
-    void setCenterPosition(const Point position) {
-        this->centerPosition = position;
-    };
+    [[nodiscard]] const RotationSystem& getRotationSystem() const {
+        return *this->rotationSystem;
+    }
 
     [[nodiscard]] std::array<Point, 4> getCurrentPosition() const {
 
+        const auto& cells = pieceShape(type, rotation).cells;
+
         std::array<Point, 4> returnArray{};
         for (int i = 0; i < 4; i++) {
-            returnArray[i].x = centerPosition.x + this->blockPositions[i].x;
-            returnArray[i].y = centerPosition.y + this->blockPositions[i].y;
+            returnArray[i].x = position.x + cells[i].x;
+            returnArray[i].y = position.y + cells[i].y;
         }
 
         return returnArray;
@@ -180,23 +105,39 @@ public:
         return this->color;
     }
 
+    // Where the block would land if it dropped straight down now
+    [[nodiscard]] std::array<Point, 4> getGhostPosition() const {
+        const int distance = gameGrid->dropDistance(pieceShape(type, rotation), position);
+
+        auto ghost = getCurrentPosition();
+        for (auto& cell : ghost) {
+            cell.y += distance;
+        }
+
+        return ghost;
+    }
+
+    // True if the block has room to fall one more row
+    [[nodiscard]] bool canMoveDown() const {
+        return areAllPositionsValid(Point{position.x, position.y + 1});
+    }
+
+    // Locks the block into the grid where it is now
+    MoveResult lock() {
+        gameGrid->addColorBlocks({getCurrentPosition(), color});
+        return MoveResult::LOCKED;
+    }
+
 
     MoveResult moveBlock(const BlockMove move) {
-        Point testPos = centerPosition;
-        auto testPositions = blockPositions;  // Copy current positions
-        bool isRotation = false;
+        Point testPos = position;
 
         switch (move) {
             case BlockMove::ROTATE:
-                // Rotate the test positions
-                for (auto& pos : testPositions) {
-                    int oldX = pos.x;
-                    int oldY = pos.y;
-                    pos.x = oldY;
-                    pos.y = -oldX;
-                }
-                isRotation = true;
-                break;
+                return rotate(RotationDirection::CLOCKWISE);
+
+            case BlockMove::ROTATE_CCW:
+                return rotate(RotationDirection::COUNTER_CLOCKWISE);
 
             case BlockMove::LEFT:
                 testPos.x -= 1;
@@ -212,53 +153,21 @@ public:
 
             case BlockMove::QUICK_DOWN:
                 // Drop all the way down
-                while (areAllPositionsValid(Point{testPos.x, testPos.y + 1})) {
-                    testPos.y += 1;
-                }
+                testPos.y += gameGrid->dropDistance(pieceShape(type, rotation), testPos);
                 // Lock immediately
-                centerPosition = testPos;
-                auto positions = getCurrentPosition();
-                gameGrid->addColorBlocks({positions, color});
-                return MoveResult::LOCKED;
-                break;
-        }
-
-        // For rotation, check with modified positions
-        if (isRotation) {
-            if (areAllPositionsValidWithCustom(testPos, testPositions)) {
-                // Valid rotation - commit it
-                blockPositions = testPositions;
-                centerPosition = testPos;
-                return MoveResult::MOVED;
-            } else {
-                // Try wall kicks
-                Point kicks[] = {{-1, 0}, {1, 0}, {0, -1}, {-2, 0}, {2, 0}};
-
-                for (const auto& kick :  kicks) {
-                    Point kickPos = {testPos.x + kick.x, testPos.y + kick. y};
-                    if (areAllPositionsValidWithCustom(kickPos, testPositions)) {
-                        blockPositions = testPositions;
-                        centerPosition = kickPos;
-                        return MoveResult::MOVED;
-                    }
-                }
-
-                // Rotation failed
-                return MoveResult::BLOCKED;
-            }
+                position = testPos;
+                return lock();
         }
 
         // For movement, check with current positions
         if (areAllPositionsValid(testPos)) {
-            centerPosition = testPos;
+            position = testPos;
             return MoveResult::MOVED;
         }
 
         // If move is DOWN and blocked, lock the block
         if (move == BlockMove::DOWN) {
-            auto positions = getCurrentPosition();
-            gameGrid->addColorBlocks({positions, color});
-            return MoveResult::LOCKED;
+            return lock();
         }
 
         return MoveResult:: BLOCKED;
@@ -266,5 +175,7 @@ public:
 
 };
 
+using Block = BasicBlock<GameGrid>;
+
 
-#endif //SIMPLETETRIS_BLOCK_H
\ No newline at end of file
+#endif //SIMPLETETRIS_BLOCK_H
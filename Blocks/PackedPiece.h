@@ -0,0 +1,81 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_PACKEDPIECE_H
+#define SIMPLETETRIS_PACKEDPIECE_H
+#include <cstdint>
+#include <type_traits>
+
+#include "enums.h"
+#include "Block.h"
+#include "RotationSystem.h"
+
+// A piece's whole state in 32 bits: type, rotation, box position and color.
+// From low to high bits: type (3), rotation (2), color (3), x + 64 (8), y + 64 (8).
+// Any box position a BasicGameGrid can hold fits, with room to spare.
+class PackedPiece {
+    std::uint32_t bits = 0;
+
+    static constexpr int POSITION_BIAS = 64;
+
+public:
+    constexpr PackedPiece() = default;
+
+    constexpr PackedPiece(const BlockType type, const int rotation, const Point position, const BlockColor color)
+        : bits(static_cast<std::uint32_t>(type)
+               | static_cast<std::uint32_t>(rotation & (ROTATION_COUNT - 1)) << 3
+               | static_cast<std::uint32_t>(color) << 5
+               | static_cast<std::uint32_t>(position.x + POSITION_BIAS) << 8
+               | static_cast<std::uint32_t>(position.y + POSITION_BIAS) << 16) {
+    }
+
+    template <typename Grid>
+    static constexpr PackedPiece fromBlock(const BasicBlock<Grid>& block) {
+        return {block.getType(), block.getRotation(), block.getPosition(), block.getColor()};
+    }
+
+    // A live block on grid in this state
+    template <typename Grid>
+    BasicBlock<Grid> toBlock(Grid* grid, const RotationSystem* rotationSystem = &RotationSystems::SRS) const {
+        BasicBlock<Grid> block(position(), type(), color(), grid, rotationSystem);
+        block.setRotation(rotation());
+        return block;
+    }
+
+    [[nodiscard]] constexpr BlockType type() const {
+        return static_cast<BlockType>(bits & 0x7);
+    }
+
+    [[nodiscard]] constexpr int rotation() const {
+        return static_cast<int>((bits >> 3) & 0x3);
+    }
+
+    [[nodiscard]] constexpr BlockColor color() const {
+        return static_cast<BlockColor>((bits >> 5) & 0x7);
+    }
+
+    [[nodiscard]] constexpr Point position() const {
+        return {static_cast<int>((bits >> 8) & 0xFF) - POSITION_BIAS,
+                static_cast<int>((bits >> 16) & 0xFF) - POSITION_BIAS};
+    }
+
+    [[nodiscard]] constexpr std::uint32_t raw() const {
+        return bits;
+    }
+
+    static constexpr PackedPiece fromRaw(const std::uint32_t raw) {
+        PackedPiece piece;
+        piece.bits = raw;
+        return piece;
+    }
+
+    constexpr bool operator==(const PackedPiece&) const = default;
+};
+
+static_assert(sizeof(PackedPiece) == 4 && std::is_trivially_copyable_v<PackedPiece>);
+static_assert(PackedPiece(BlockType::L, 3, {-3, -2}, BlockColor::ORANGE).position().x == -3);
+static_assert(PackedPiece(BlockType::L, 3, {-3, -2}, BlockColor::ORANGE).rotation() == 3);
+
+
+#endif //SIMPLETETRIS_PACKEDPIECE_H
@@ -0,0 +1,116 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_PIECETABLES_H
+#define SIMPLETETRIS_PIECETABLES_H
+#include <array>
+#include <cstdint>
+
+#include "enums.h"
+
+// One orientation of one piece. Cells are offsets from the block position, which
+// is the top-left corner of the piece's bounding box (4x4 for I, 3x3 for the rest).
+struct PieceShape {
+    std::array<Point, 4> cells;
+
+    // bit dx is set in rowMasks[dy] for every cell at (dx, dy), shifted onto a grid row
+    // mask this tests all cells of a row in one AND
+    std::array<std::uint8_t, 4> rowMasks;
+
+    // bounds of the occupied cells inside the box
+    int minX;
+    int maxX;
+    int minY;
+    int maxY;
+};
+
+constexpr int PIECE_TYPE_COUNT = 7;
+constexpr int ROTATION_COUNT = 4;
+
+namespace PieceTables {
+
+    // Spawn orientations in BlockType order (I, O, T, S, Z, J, L), y grows downwards
+    constexpr std::array<std::array<Point, 4>, PIECE_TYPE_COUNT> SPAWN_CELLS{{
+        {{{0, 1}, {1, 1}, {2, 1}, {3, 1}}},  // I
+        {{{1, 0}, {2, 0}, {1, 1}, {2, 1}}},  // O
+        {{{1, 0}, {0, 1}, {1, 1}, {2, 1}}},  // T
+        {{{1, 0}, {2, 0}, {0, 1}, {1, 1}}},  // S
+        {{{0, 0}, {1, 0}, {1, 1}, {2, 1}}},  // Z
+        {{{0, 0}, {0, 1}, {1, 1}, {2, 1}}},  // J
+        {{{2, 0}, {0, 1}, {1, 1}, {2, 1}}},  // L
+    }};
+
+    constexpr std::array<int, PIECE_TYPE_COUNT> BOX_SIZE{4, 3, 3, 3, 3, 3, 3};
+
+    // 90 degrees clockwise on screen inside a size x size box
+    constexpr std::array<Point, 4> rotateClockwise(const std::array<Point, 4>& cells, const int size) {
+        std::array<Point, 4> rotated{};
+        for (int i = 0; i < 4; i++) {
+            rotated[i] = {size - 1 - cells[i].y, cells[i].x};
+        }
+        return rotated;
+    }
+
+    constexpr PieceShape makeShape(const std::array<Point, 4>& cells) {
+        PieceShape shape{cells, {}, 3, 0, 3, 0};
+
+        for (const auto& cell : cells) {
+            shape.rowMasks[cell.y] |= static_cast<std::uint8_t>(1u << cell.x);
+
+            if (cell.x < shape.minX) shape.minX = cell.x;
+            if (cell.x > shape.maxX) shape.maxX = cell.x;
+            if (cell.y < shape.minY) shape.minY = cell.y;
+            if (cell.y > shape.maxY) shape.maxY = cell.y;
+        }
+
+        return shape;
+    }
+
+    constexpr std::array<std::array<PieceShape, ROTATION_COUNT>, PIECE_TYPE_COUNT> buildShapes() {
+        std::array<std::array<PieceShape, ROTATION_COUNT>, PIECE_TYPE_COUNT> shapes{};
+
+        for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+            auto cells = SPAWN_CELLS[type];
+
+            for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+                shapes[type][rotation] = makeShape(cells);
+
+                // the O piece looks the same in every orientation and doesn't wobble around
+                if (static_cast<BlockType>(type) != BlockType::O) {
+                    cells = rotateClockwise(cells, BOX_SIZE[type]);
+                }
+            }
+        }
+
+        return shapes;
+    }
+
+    constexpr auto SHAPES = buildShapes();
+}
+
+constexpr const PieceShape& pieceShape(const BlockType type, const int rotation) {
+    return PieceTables::SHAPES[static_cast<int>(type)][rotation & (ROTATION_COUNT - 1)];
+}
+
+// Every piece type has its own color, in BlockType order
+constexpr BlockColor pieceColor(const BlockType type) {
+    constexpr std::array<BlockColor, PIECE_TYPE_COUNT> colors{
+        BlockColor::CYAN,    // I
+        BlockColor::YELLOW,  // O
+        BlockColor::PURPLE,  // T
+        BlockColor::GREEN,   // S
+        BlockColor::RED,     // Z
+        BlockColor::BLUE,    // J
+        BlockColor::ORANGE,  // L
+    };
+    return colors[static_cast<int>(type)];
+}
+
+// T pointing right after one clockwise turn, I standing in the third column
+static_assert(pieceShape(BlockType::T, 1).rowMasks[0] == 0b010 && pieceShape(BlockType::T, 1).rowMasks[1] == 0b110);
+static_assert(pieceShape(BlockType::I, 1).minX == 2 && pieceShape(BlockType::I, 1).maxY == 3);
+static_assert(pieceShape(BlockType::O, 3).rowMasks[0] == pieceShape(BlockType::O, 0).rowMasks[0]);
+
+
+#endif //SIMPLETETRIS_PIECETABLES_H
@@ -0,0 +1,162 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_ROTATIONSYSTEM_H
+#define SIMPLETETRIS_ROTATIONSYSTEM_H
+#include <array>
+
+#include "enums.h"
+#include "PieceTables.h"
+
+enum class RotationDirection {
+    CLOCKWISE = 0,
+    COUNTER_CLOCKWISE = 1
+};
+
+// Offsets a rotation tries in order until the piece fits, y grows downwards
+struct KickTable {
+    static constexpr int MAX_KICKS = 6;
+
+    std::array<Point, MAX_KICKS> offsets{};
+    int count = 0;
+};
+
+// Which kicks every piece tries for every rotation. Swap in another system to change how
+// pieces rotate, the shapes themselves always come from PieceTables.h.
+struct RotationSystem {
+    // [piece type][rotation before turning][direction]
+    std::array<std::array<std::array<KickTable, 2>, ROTATION_COUNT>, PIECE_TYPE_COUNT> kicks{};
+
+    [[nodiscard]] constexpr const KickTable& kicksFor(
+        const BlockType type,
+        const int fromRotation,
+        const RotationDirection direction
+    ) const {
+        return kicks[static_cast<int>(type)][fromRotation & (ROTATION_COUNT - 1)][static_cast<int>(direction)];
+    }
+
+    static constexpr int rotatedIndex(const int fromRotation, const RotationDirection direction) {
+        const int step = direction == RotationDirection::CLOCKWISE ? 1 : ROTATION_COUNT - 1;
+        return (fromRotation + step) & (ROTATION_COUNT - 1);
+    }
+
+    // Turns the piece if any kick lets it fit, updating rotation and position.
+    // Works on anything with GameGrid's fits(), so search code can use it on its own boards.
+    template <typename Grid>
+    bool tryRotate(
+        const Grid& grid,
+        const BlockType type,
+        int& rotation,
+        Point& position,
+        const RotationDirection direction
+    ) const {
+        const int toRotation = rotatedIndex(rotation, direction);
+        const PieceShape& shape = pieceShape(type, toRotation);
+        const KickTable& table = kicksFor(type, rotation, direction);
+
+        for (int i = 0; i < table.count; i++) {
+            const Point kicked{position.x + table.offsets[i].x, position.y + table.offsets[i].y};
+
+            if (grid.fits(shape, kicked)) {
+                rotation = toRotation;
+                position = kicked;
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+namespace RotationSystems {
+
+    // SRS kick data as published, x right and y UP, for the 8 transitions in the order
+    // 0->R, R->2, 2->L, L->0 (clockwise) then 0->L, R->0, 2->R, L->2 (counter-clockwise)
+    using SrsTransitions = std::array<std::array<Point, 5>, 8>;
+
+    constexpr SrsTransitions SRS_JLSTZ{{
+        {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}},
+        {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+        {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},
+        {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},
+
+        {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},
+        {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+        {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}},
+        {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},
+    }};
+
+    constexpr SrsTransitions SRS_I{{
+        {{{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}}},
+        {{{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}}},
+        {{{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}}},
+        {{{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}}},
+
+        {{{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}}},
+        {{{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}}},
+        {{{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}}},
+        {{{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}}},
+    }};
+
+    constexpr RotationSystem buildSrs() {
+        RotationSystem system{};
+
+        for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+            const BlockType blockType = static_cast<BlockType>(type);
+            const SrsTransitions& transitions = blockType == BlockType::I ? SRS_I : SRS_JLSTZ;
+
+            for (int from = 0; from < ROTATION_COUNT; from++) {
+                for (int direction = 0; direction < 2; direction++) {
+                    KickTable& table = system.kicks[type][from][direction];
+
+                    // O never moves when it turns
+                    if (blockType == BlockType::O) {
+                        table.offsets[0] = {0, 0};
+                        table.count = 1;
+                        continue;
+                    }
+
+                    const auto& offsets = transitions[direction * ROTATION_COUNT + from];
+                    for (int i = 0; i < 5; i++) {
+                        // flip y, our rows count downwards
+                        table.offsets[i] = {offsets[i].x, -offsets[i].y};
+                    }
+                    table.count = 5;
+                }
+            }
+        }
+
+        return system;
+    }
+
+    // The kicks the game used before SRS, the same list for every piece and direction
+    constexpr RotationSystem buildClassic() {
+        constexpr std::array<Point, 6> offsets{{{0, 0}, {-1, 0}, {1, 0}, {0, -1}, {-2, 0}, {2, 0}}};
+
+        RotationSystem system{};
+
+        for (auto& piece : system.kicks) {
+            for (auto& from : piece) {
+                for (auto& table : from) {
+                    for (int i = 0; i < 6; i++) {
+                        table.offsets[i] = offsets[i];
+                    }
+                    table.count = 6;
+                }
+            }
+        }
+
+        return system;
+    }
+
+    constexpr RotationSystem SRS = buildSrs();
+    constexpr RotationSystem CLASSIC = buildClassic();
+}
+
+// I going 0->R has to try two columns to the left first
+static_assert(RotationSystems::SRS.kicksFor(BlockType::I, 0, RotationDirection::CLOCKWISE).offsets[1].x == -2);
+static_assert(RotationSystems::SRS.kicksFor(BlockType::T, 0, RotationDirection::CLOCKWISE).offsets[2].y == -1);
+
+
+#endif //SIMPLETETRIS_ROTATIONSYSTEM_H
@@ -0,0 +1,325 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#include "BoardFeatures.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string_view>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FEATURES_X86 1
+#include <immintrin.h>
+
+// GCC and Clang only emit an instruction set inside functions marked for it, MSVC always does
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define FEATURES_TARGET(isa)
+#else
+#define FEATURES_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+
+namespace FeatureKernels {
+
+    BoardFeatures scalar(const std::uint16_t* rows, const Layout& layout) {
+        BoardFeatures features;
+
+        int filled = 0;
+        std::uint16_t covered = 0;
+        std::uint16_t above = layout.emptyRow;
+
+        for (int y = 0; y < layout.height; y++) {
+            const std::uint16_t row = rows[y];
+            covered |= row & layout.playfield;
+
+            features.aggregateHeight += std::popcount(covered);
+            features.maxHeight += covered != 0;
+            filled += std::popcount(static_cast<std::uint16_t>(row & layout.playfield));
+            features.bumpiness += std::popcount(static_cast<std::uint16_t>((covered ^ (covered >> 1)) & layout.neighbours));
+            features.rowTransitions += std::popcount(static_cast<std::uint16_t>((row ^ (row >> 1)) & layout.rowTransitions));
+            features.columnTransitions += std::popcount(static_cast<std::uint16_t>((row ^ above) & layout.playfield));
+            features.wells += std::popcount(static_cast<std::uint16_t>(~covered & (row << 1) & (row >> 1) & layout.playfield));
+
+            above = row;
+        }
+
+        features.holes = features.aggregateHeight - filled;
+        features.columnTransitions += std::popcount(static_cast<std::uint16_t>(~above & layout.playfield));
+
+        return features;
+    }
+
+#ifdef FEATURES_X86
+
+    // The vector kernels load the rows a register at a time, a last partial register gets
+    // padded with empty rows and its lanes past the last row are masked out of the sums. Per lane they compute the same popcounts as
+    // scalar, the lane sums get folded with hadd so the results come out in
+    // BoardFeatures order. holes comes out as the filled cell count and gets fixed up
+    // at the end, the floor's column transitions get added the same way.
+
+    static void finish(BoardFeatures& features, const std::uint16_t* rows, const Layout& layout) {
+        features.holes = features.aggregateHeight - features.holes;
+        features.columnTransitions += std::popcount(static_cast<std::uint16_t>(~rows[layout.height - 1] & layout.playfield));
+    }
+
+    // 16 bit popcount per lane: a nibble lookup per byte, then the two bytes of a lane added
+    FEATURES_TARGET("ssse3")
+    static __m128i popcount16(const __m128i x) {
+        const __m128i table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+
+        const __m128i low = _mm_shuffle_epi8(table, _mm_and_si128(x, nibble));
+        const __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+        return _mm_maddubs_epi16(_mm_add_epi8(low, high), _mm_set1_epi8(1));
+    }
+
+    // the next 8 rows, or what's left of them topped up with empty ones
+    FEATURES_TARGET("ssse3")
+    static __m128i load8Rows(const std::uint16_t* rows, const int count, const std::uint16_t emptyRow) {
+        if (count >= 8) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows));
+        }
+
+        std::uint16_t padded[8];
+        std::copy_n(rows, count, padded);
+        std::fill(padded + count, padded + 8, emptyRow);
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(padded));
+    }
+
+    // adds the lanes that hold real rows
+    FEATURES_TARGET("ssse3")
+    static void accumulate(__m128i& sum, const __m128i counts, const __m128i inRange) {
+        sum = _mm_add_epi16(sum, _mm_and_si128(counts, inRange));
+    }
+
+    // 16 bit lane sums into 32 bit ones, neighbouring lanes added
+    FEATURES_TARGET("ssse3")
+    static __m128i widen(const __m128i sum) {
+        return _mm_madd_epi16(sum, _mm_set1_epi16(1));
+    }
+
+    // 8 rows per register
+    FEATURES_TARGET("ssse3")
+    BoardFeatures ssse3(const std::uint16_t* rows, const Layout& layout) {
+        const __m128i playfield = _mm_set1_epi16(static_cast<short>(layout.playfield));
+        const __m128i rowTransitions = _mm_set1_epi16(static_cast<short>(layout.rowTransitions));
+        const __m128i neighbours = _mm_set1_epi16(static_cast<short>(layout.neighbours));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(1);
+        const __m128i lane = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+
+        __m128i aggregate = zero, tops = zero, filled = zero, bumpiness = zero;
+        __m128i rowChanges = zero, columnChanges = zero, wells = zero;
+
+        __m128i previous = zero;
+        __m128i coveredBefore = zero;
+
+        for (int y = 0; y < layout.height; y += 8) {
+            const __m128i row = load8Rows(rows + y, layout.height - y, layout.emptyRow);
+            const __m128i inRange = _mm_cmpgt_epi16(_mm_set1_epi16(static_cast<short>(layout.height - y)), lane);
+
+            // the row above each lane, the top row's is empty
+            const __m128i above = _mm_alignr_epi8(row, previous, 14);
+
+            // running OR down the lanes, then everything covered before this register
+            __m128i covered = _mm_and_si128(row, playfield);
+            covered = _mm_or_si128(covered, _mm_slli_si128(covered, 2));
+            covered = _mm_or_si128(covered, _mm_slli_si128(covered, 4));
+            covered = _mm_or_si128(covered, _mm_slli_si128(covered, 8));
+            covered = _mm_or_si128(covered, coveredBefore);
+            coveredBefore = _mm_set1_epi16(static_cast<short>(_mm_extract_epi16(covered, 7)));
+
+            const __m128i left = _mm_slli_epi16(row, 1);
+            const __m128i right = _mm_srli_epi16(row, 1);
+
+
+            accumulate(aggregate, popcount16(covered), inRange);
+            accumulate(tops, _mm_andnot_si128(_mm_cmpeq_epi16(covered, zero), one), inRange);
+            accumulate(filled, popcount16(_mm_and_si128(row, playfield)), inRange);
+            accumulate(bumpiness, popcount16(_mm_and_si128(_mm_xor_si128(covered, _mm_srli_epi16(covered, 1)), neighbours)), inRange);
+            accumulate(rowChanges, popcount16(_mm_and_si128(_mm_xor_si128(row, right), rowTransitions)), inRange);
+            accumulate(columnChanges, popcount16(_mm_and_si128(_mm_xor_si128(row, above), playfield)), inRange);
+            accumulate(wells, popcount16(_mm_andnot_si128(covered, _mm_and_si128(_mm_and_si128(left, right), playfield))), inRange);
+
+            previous = row;
+        }
+
+        // two rounds of hadd leave one sum per feature, the empty slot is linesCleared
+        const __m128i low = _mm_hadd_epi32(_mm_hadd_epi32(widen(aggregate), widen(tops)),
+                                           _mm_hadd_epi32(widen(filled), widen(bumpiness)));
+        const __m128i high = _mm_hadd_epi32(_mm_hadd_epi32(zero, widen(rowChanges)),
+                                            _mm_hadd_epi32(widen(columnChanges), widen(wells)));
+
+        BoardFeatures features;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&features.aggregateHeight), low);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&features.linesCleared), high);
+        finish(features, rows, layout);
+        return features;
+    }
+
+    // Moves every 16 bit lane up by one across the whole register, lane 0 takes previous's last lane
+    FEATURES_TARGET("avx2")
+    static __m256i laneBefore(const __m256i x, const __m256i previous) {
+        return _mm256_alignr_epi8(x, _mm256_permute2x128_si256(previous, x, 0x21), 14);
+    }
+
+    FEATURES_TARGET("avx2")
+    static __m256i popcount16(const __m256i x) {
+        const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+        const __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(x, nibble));
+        const __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+        return _mm256_maddubs_epi16(_mm256_add_epi8(low, high), _mm256_set1_epi8(1));
+    }
+
+    // the next 16 rows, topped up the same way
+    FEATURES_TARGET("avx2")
+    static __m256i load16Rows(const std::uint16_t* rows, const int count, const std::uint16_t emptyRow) {
+        if (count >= 16) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows));
+        }
+        // the standard board's last 8 rows, no need to go through memory
+        if (count == 8) {
+            return _mm256_inserti128_si256(_mm256_set1_epi16(static_cast<short>(emptyRow)),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows)), 0);
+        }
+
+        std::uint16_t padded[16];
+        std::copy_n(rows, count, padded);
+        std::fill(padded + count, padded + 16, emptyRow);
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(padded));
+    }
+
+    FEATURES_TARGET("avx2")
+    static void accumulate(__m256i& sum, const __m256i counts, const __m256i inRange) {
+        sum = _mm256_add_epi16(sum, _mm256_and_si256(counts, inRange));
+    }
+
+    FEATURES_TARGET("avx2")
+    static __m256i widen(const __m256i sum) {
+        return _mm256_madd_epi16(sum, _mm256_set1_epi16(1));
+    }
+
+    // 16 rows per register, the standard board is two of them
+    FEATURES_TARGET("avx2")
+    BoardFeatures avx2(const std::uint16_t* rows, const Layout& layout) {
+        const __m256i playfield = _mm256_set1_epi16(static_cast<short>(layout.playfield));
+        const __m256i rowTransitions = _mm256_set1_epi16(static_cast<short>(layout.rowTransitions));
+        const __m256i neighbours = _mm256_set1_epi16(static_cast<short>(layout.neighbours));
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi16(1);
+        const __m256i lane = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+        __m256i aggregate = zero, tops = zero, filled = zero, bumpiness = zero;
+        __m256i rowChanges = zero, columnChanges = zero, wells = zero;
+
+        __m256i previous = zero;
+        __m256i coveredBefore = zero;
+
+        for (int y = 0; y < layout.height; y += 16) {
+            const __m256i row = load16Rows(rows + y, layout.height - y, layout.emptyRow);
+            const __m256i inRange = _mm256_cmpgt_epi16(_mm256_set1_epi16(static_cast<short>(layout.height - y)), lane);
+
+            const __m256i above = laneBefore(row, previous);
+
+            // running OR down the lanes, 1, 2, 4 and 8 lanes at a time
+            __m256i covered = _mm256_and_si256(row, playfield);
+            covered = _mm256_or_si256(covered, _mm256_alignr_epi8(covered, _mm256_permute2x128_si256(covered, covered, 0x08), 14));
+            covered = _mm256_or_si256(covered, _mm256_alignr_epi8(covered, _mm256_permute2x128_si256(covered, covered, 0x08), 12));
+            covered = _mm256_or_si256(covered, _mm256_alignr_epi8(covered, _mm256_permute2x128_si256(covered, covered, 0x08), 8));
+            covered = _mm256_or_si256(covered, _mm256_permute2x128_si256(covered, covered, 0x08));
+            covered = _mm256_or_si256(covered, coveredBefore);
+            coveredBefore = _mm256_set1_epi16(static_cast<short>(_mm256_extract_epi16(covered, 15)));
+
+            const __m256i left = _mm256_slli_epi16(row, 1);
+            const __m256i right = _mm256_srli_epi16(row, 1);
+
+
+            accumulate(aggregate, popcount16(covered), inRange);
+            accumulate(tops, _mm256_andnot_si256(_mm256_cmpeq_epi16(covered, zero), one), inRange);
+            accumulate(filled, popcount16(_mm256_and_si256(row, playfield)), inRange);
+            accumulate(bumpiness, popcount16(_mm256_and_si256(_mm256_xor_si256(covered, _mm256_srli_epi16(covered, 1)), neighbours)), inRange);
+            accumulate(rowChanges, popcount16(_mm256_and_si256(_mm256_xor_si256(row, right), rowTransitions)), inRange);
+            accumulate(columnChanges, popcount16(_mm256_and_si256(_mm256_xor_si256(row, above), playfield)), inRange);
+            accumulate(wells, popcount16(_mm256_andnot_si256(covered, _mm256_and_si256(_mm256_and_si256(left, right), playfield))), inRange);
+
+            previous = row;
+        }
+
+        // hadd works inside each 128 bit half, so each half ends up with its own partial
+        // sums in feature order and the two halves just get added
+        const __m256i low = _mm256_hadd_epi32(_mm256_hadd_epi32(widen(aggregate), widen(tops)),
+                                              _mm256_hadd_epi32(widen(filled), widen(bumpiness)));
+        const __m256i high = _mm256_hadd_epi32(_mm256_hadd_epi32(zero, widen(rowChanges)),
+                                               _mm256_hadd_epi32(widen(columnChanges), widen(wells)));
+
+        BoardFeatures features;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&features.aggregateHeight),
+                         _mm_add_epi32(_mm256_castsi256_si128(low), _mm256_extracti128_si256(low, 1)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&features.linesCleared),
+                         _mm_add_epi32(_mm256_castsi256_si128(high), _mm256_extracti128_si256(high, 1)));
+        finish(features, rows, layout);
+        return features;
+    }
+
+    // cpuid leaf 1 for SSSE3 and OS saved AVX state, leaf 7 for AVX2
+    static bool supports(const char* isa) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        const bool ssse3 = (info[2] & (1 << 9)) != 0;
+        const bool avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+
+        if (std::string_view(isa) == "ssse3") {
+            return ssse3;
+        }
+
+        __cpuidex(info, 7, 0);
+        return avx && (info[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        return std::string_view(isa) == "avx2" ? __builtin_cpu_supports("avx2") : __builtin_cpu_supports("ssse3");
+#endif
+    }
+
+#endif
+
+    std::span<const NamedKernel> availableKernels() {
+        static const auto kernels = [] {
+            std::array<NamedKernel, 3> list{};
+            std::size_t count = 0;
+#ifdef FEATURES_X86
+            if (supports("avx2")) {
+                list[count++] = {"avx2", avx2};
+            }
+            if (supports("ssse3")) {
+                list[count++] = {"ssse3", ssse3};
+            }
+#endif
+            list[count++] = {"scalar", scalar};
+            return std::pair{list, count};
+        }();
+
+        return std::span(kernels.first.data(), kernels.second);
+    }
+
+    Kernel select() {
+        return availableKernels().front().kernel;
+    }
+
+    const char* selectedName() {
+        for (const auto& [name, kernel] : availableKernels()) {
+            if (kernel == active()) {
+                return name;
+            }
+        }
+        return "scalar";
+    }
+}
@@ -0,0 +1,179 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_BOARDFEATURES_H
+#define SIMPLETETRIS_BOARDFEATURES_H
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// What the bot looks at to judge a board. Eight int32s in a fixed order, 32 bytes,
+// so the SIMD kernels can fill it straight from one vector of lane sums.
+struct BoardFeatures {
+    // sum of all column heights
+    std::int32_t aggregateHeight = 0;
+    std::int32_t maxHeight = 0;
+    // empty cells with a filled cell somewhere above them
+    std::int32_t holes = 0;
+    // sum of height differences between neighbouring columns
+    std::int32_t bumpiness = 0;
+    std::int32_t linesCleared = 0;
+    // filled/empty changes along each row, the walls count as filled
+    std::int32_t rowTransitions = 0;
+    // filled/empty changes down each column, the floor counts as filled
+    std::int32_t columnTransitions = 0;
+    // open cells with something on both sides, so a well n deep counts n
+    std::int32_t wells = 0;
+};
+
+static_assert(sizeof(BoardFeatures) == 32 && std::is_standard_layout_v<BoardFeatures>);
+
+
+// Every feature is a sum over rows of a popcount, which is what makes them vectorise:
+//  - covered is a running OR of the rows from the top, so a column's bit is set from its top down.
+//    Summing popcount(covered) gives the aggregate height and the rows with anything covered give the max.
+//  - holes are covered cells that aren't filled, aggregate height minus filled cells.
+//  - two neighbouring columns differ in covered on exactly |h0 - h1| rows, that's bumpiness.
+//  - transitions are popcounts of a row XOR its neighbour row or its own shifted self.
+namespace FeatureMasks {
+    template <typename Grid>
+    using RowMask = typename Grid::RowMask;
+
+    // bit b set counts a change between bits b and b + 1, from the left wall to the right wall
+    template <typename Grid>
+    constexpr RowMask<Grid> ROW_TRANSITIONS = static_cast<RowMask<Grid>>(
+        ((RowMask<Grid>{1} << (Grid::WIDTH + 1)) - 1) << (Grid::WALL_BITS - 1));
+
+    // bit b set compares column b with column b + 1, both inside the playfield
+    template <typename Grid>
+    constexpr RowMask<Grid> NEIGHBOURS = static_cast<RowMask<Grid>>(
+        ((RowMask<Grid>{1} << (Grid::WIDTH - 1)) - 1) << Grid::WALL_BITS);
+}
+
+// Plain loop over the rows, works for any board
+template <typename Grid>
+BoardFeatures extractFeaturesScalar(const std::span<const typename Grid::RowMask, Grid::HEIGHT> rows, const int linesCleared) {
+    using RowMask = typename Grid::RowMask;
+    constexpr RowMask playfield = Grid::PLAYFIELD;
+
+    BoardFeatures features;
+    features.linesCleared = linesCleared;
+
+    int filled = 0;
+    RowMask covered = 0;
+    RowMask above = Grid::EMPTY_ROW;
+
+    for (int y = 0; y < Grid::HEIGHT; y++) {
+        const RowMask row = rows[y];
+        covered |= row & playfield;
+
+        features.aggregateHeight += std::popcount(covered);
+        features.maxHeight += covered != 0;
+        filled += std::popcount(static_cast<RowMask>(row & playfield));
+        features.bumpiness += std::popcount(static_cast<RowMask>((covered ^ (covered >> 1)) & FeatureMasks::NEIGHBOURS<Grid>));
+        features.rowTransitions += std::popcount(static_cast<RowMask>((row ^ (row >> 1)) & FeatureMasks::ROW_TRANSITIONS<Grid>));
+        features.columnTransitions += std::popcount(static_cast<RowMask>((row ^ above) & playfield));
+        features.wells += std::popcount(static_cast<RowMask>(~covered & (row << 1) & (row >> 1) & playfield));
+
+        above = row;
+    }
+
+    features.holes = features.aggregateHeight - filled;
+    features.columnTransitions += std::popcount(static_cast<RowMask>(~above & playfield));
+
+    return features;
+}
+
+
+// Height of every column, 0 for an empty one. BoardFeatures only carries their sum, max and
+// bumpiness, for the heights themselves there's these two.
+template <typename Grid>
+std::array<std::int32_t, Grid::WIDTH> columnHeights(const Grid& grid) {
+    std::array<std::int32_t, Grid::WIDTH> heights{};
+    for (int x = 0; x < Grid::WIDTH; x++) {
+        heights[x] = grid.columnHeight(x);
+    }
+    return heights;
+}
+
+// Same off bare row masks, for boards that only exist inside a search. The first row a
+// column shows up in is its top, so each row's new bits are tops found with countr_zero.
+template <typename Grid>
+std::array<std::int32_t, Grid::WIDTH> columnHeights(const std::span<const typename Grid::RowMask, Grid::HEIGHT> rows) {
+    using RowMask = typename Grid::RowMask;
+
+    std::array<std::int32_t, Grid::WIDTH> heights{};
+    RowMask covered = 0;
+
+    for (int y = 0; y < Grid::HEIGHT && covered != Grid::PLAYFIELD; y++) {
+        for (RowMask tops = rows[y] & Grid::PLAYFIELD & static_cast<RowMask>(~covered); tops != 0; tops &= tops - 1) {
+            heights[std::countr_zero(tops) - Grid::WALL_BITS] = Grid::HEIGHT - y;
+        }
+        covered |= rows[y] & Grid::PLAYFIELD;
+    }
+
+    return heights;
+}
+
+
+// Hand vectorised versions for 16 bit rows, the standard board's. The rows sit one per
+// 16 bit lane, so a 10x24 board is a couple of registers and every feature is a handful of
+// lane ops plus a byte table popcount. Which one runs is picked once from the CPU.
+namespace FeatureKernels {
+    // the most rows a kernel takes, two AVX2 registers worth
+    inline constexpr int MAX_ROWS = 32;
+
+    struct Layout {
+        int height;
+        std::uint16_t emptyRow;
+        std::uint16_t playfield;
+        std::uint16_t rowTransitions;
+        std::uint16_t neighbours;
+    };
+
+    using Kernel = BoardFeatures (*)(const std::uint16_t* rows, const Layout& layout);
+
+    BoardFeatures scalar(const std::uint16_t* rows, const Layout& layout);
+
+    struct NamedKernel {
+        const char* name;
+        Kernel kernel;
+    };
+
+    // every kernel this build has that the CPU can run, best first: AVX2, SSSE3, scalar
+    std::span<const NamedKernel> availableKernels();
+
+    // the first of those, and its name
+    Kernel select();
+    const char* selectedName();
+
+    // The kernel extractFeatures() runs. Picked on first use rather than at static init, so
+    // other static initializers can already extract features, and thread safe like any local static.
+    inline Kernel active() {
+        static const Kernel kernel = select();
+        return kernel;
+    }
+
+    template <typename Grid>
+    constexpr Layout LAYOUT{
+        Grid::HEIGHT, Grid::EMPTY_ROW, Grid::PLAYFIELD,
+        FeatureMasks::ROW_TRANSITIONS<Grid>, FeatureMasks::NEIGHBOURS<Grid>
+    };
+}
+
+template <typename Grid>
+BoardFeatures extractFeatures(const std::span<const typename Grid::RowMask, Grid::HEIGHT> rows, const int linesCleared) {
+    if constexpr (std::is_same_v<typename Grid::RowMask, std::uint16_t> && Grid::HEIGHT <= FeatureKernels::MAX_ROWS) {
+        BoardFeatures features = FeatureKernels::active()(rows.data(), FeatureKernels::LAYOUT<Grid>);
+        features.linesCleared = linesCleared;
+        return features;
+    } else {
+        return extractFeaturesScalar<Grid>(rows, linesCleared);
+    }
+}
+
+
+#endif //SIMPLETETRIS_BOARDFEATURES_H
@@ -0,0 +1,10 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#include "Bot.h"
+#include "Lookahead.h"
+
+// Compile the standard board's bots into tetris_bot once
+template class BasicBot<GameGrid>;
+template class BasicLookahead<GameGrid>;
@@ -0,0 +1,105 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_BOT_H
+#define SIMPLETETRIS_BOT_H
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+
+#include "BoardFeatures.h"
+#include "PlacementSearch.h"
+#include "Blocks/Block.h"
+#include "GameManager/GameGrid.h"
+
+// How much each feature counts, higher scores are better.
+// The defaults are Yiyuan Lee's genetically tuned weights, which don't use
+// the transition and well features so those start off at 0.
+struct BotWeights {
+    double aggregateHeight = -0.510066;
+    double linesCleared = 0.760666;
+    double holes = -0.35663;
+    double bumpiness = -0.184483;
+    double rowTransitions = 0;
+    double columnTransitions = 0;
+    double wells = 0;
+};
+
+// Plays one piece at a time: tries every placement, scores the board each one leaves
+// behind and goes for the best. Use Bot for the standard board.
+template <typename Grid>
+class BasicBot {
+public:
+    using Search = BasicPlacementSearch<Grid>;
+    using Moves = std::array<BlockMove, Search::MAX_MOVES>;
+
+private:
+    BotWeights weights;
+
+public:
+    explicit BasicBot(const BotWeights& weights = {}) : weights(weights) {
+    }
+
+    [[nodiscard]] double score(const BoardFeatures& features) const {
+        return weights.aggregateHeight * features.aggregateHeight
+             + weights.linesCleared * features.linesCleared
+             + weights.holes * features.holes
+             + weights.bumpiness * features.bumpiness
+             + weights.rowTransitions * features.rowTransitions
+             + weights.columnTransitions * features.columnTransitions
+             + weights.wells * features.wells;
+    }
+
+    // The best placement for a piece at start, nothing if it can't go anywhere
+    [[nodiscard]] std::optional<Placement> choose(const Grid& grid, const BlockType type,
+                                                  const int rotation, const Point start,
+                                                  const RotationSystem& rotationSystem = RotationSystems::SRS) const {
+        std::array<Placement, Search::MAX_PLACEMENTS> placements;
+        const int count = Search::enumerate(grid.getRows(), type, rotation, start, rotationSystem, placements);
+
+        std::optional<Placement> best;
+        double bestScore = 0;
+
+        for (int i = 0; i < count; i++) {
+            typename Search::Rows rows;
+            const auto gridRows = grid.getRows();
+            std::copy(gridRows.begin(), gridRows.end(), rows.begin());
+
+            const int linesCleared = Search::land(rows, placements[i]);
+            const double placementScore = score(extractFeatures<Grid>(rows, linesCleared));
+
+            if (!best.has_value() || placementScore > bestScore) {
+                best = placements[i];
+                bestScore = placementScore;
+            }
+        }
+
+        return best;
+    }
+
+    // Picks a placement for the block and writes the moves that play it, returns how many.
+    // Without any placement it just drops the block where it is.
+    int plan(const Grid& grid, const BasicBlock<Grid>& block, const std::span<BlockMove, Search::MAX_MOVES> moves) const {
+        const auto placement = choose(grid, block.getType(), block.getRotation(), block.getPosition(),
+                                      block.getRotationSystem());
+
+        const int count = placement.has_value()
+                              ? Search::movesFor(grid, block.getType(), block.getRotation(), block.getPosition(),
+                                                 block.getRotationSystem(), *placement, moves)
+                              : -1;
+
+        if (count < 0) {
+            moves[0] = BlockMove::QUICK_DOWN;
+            return 1;
+        }
+
+        return count;
+    }
+};
+
+using Bot = BasicBot<GameGrid>;
+
+
+#endif //SIMPLETETRIS_BOT_H
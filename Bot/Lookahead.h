@@ -0,0 +1,373 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_LOOKAHEAD_H
+#define SIMPLETETRIS_LOOKAHEAD_H
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "Bot.h"
+#include "BoardFeatures.h"
+#include "PlacementSearch.h"
+#include "SearchArena.h"
+#include "TranspositionTable.h"
+#include "Blocks/Block.h"
+#include "GameManager/GameState.h"
+
+struct LookaheadConfig {
+    // pieces looked at, the current one included, 1 plays like the greedy bot
+    int maxDepth = 2;
+    // how many of the best placements per piece get searched deeper
+    int beamWidth = 6;
+    // deepen until this runs out, zero always finishes maxDepth
+    std::chrono::microseconds timeBudget{0};
+    // transposition table size, 0 searches without one
+    std::size_t tableMegabytes = 4;
+};
+
+// Searches several pieces ahead: the current one, the preview queue, and past the preview
+// the average over all seven piece types. At every piece only the best few placements by
+// the one-piece score (the beam) are searched deeper, which doubles as move ordering.
+// With a time budget it deepens one piece at a time and keeps the deepest finished answer.
+// Positions reached more than once, within one search or across the searches for
+// consecutive pieces, come out of a transposition table. Search scratch lives in an arena
+// that is reset per piece, so after the first piece choosing never touches the heap.
+// Use Lookahead for the standard board.
+template <typename Grid>
+class BasicLookahead {
+public:
+    using Search = BasicPlacementSearch<Grid>;
+    using Rows = typename Search::Rows;
+    using Moves = typename BasicBot<Grid>::Moves;
+
+    // table entries count depth in a byte
+    static constexpr int MAX_DEPTH = 255;
+
+    struct SearchStats {
+        std::uint64_t nodes = 0;
+        // deepest search that finished, or got far enough to trust, for the last choice
+        int depthReached = 0;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // a topped out board scores this, far below anything still alive
+    static constexpr double LOSS = -1e9;
+
+    // One candidate in a beam: the board after the placement and what it scored so far
+    struct Child {
+        Placement placement;
+        Rows rows;
+        std::uint64_t hash;
+        double reward;  // line clears along the way
+        double score;   // reward plus the board's static score, for ordering
+    };
+
+    // Scratch for one depth, sized for the search at hand
+    struct Ply {
+        std::span<Placement> placements;
+        std::span<Child> beam;
+    };
+
+    BasicBot<Grid> bot;
+    LookaheadConfig config;
+
+    // All per-search memory comes from here and goes back at the start of the next piece
+    SearchArena arena;
+
+    std::span<Ply> plies;
+
+    // the pieces known in advance for the running search, [0] is the active one
+    std::span<BlockType> known;
+    int knownCount = 0;
+
+    // how many pieces came before the active one, so table entries stay valid from piece to piece
+    std::uint64_t pieceIndex = 0;
+
+    TranspositionTable table;
+
+    int depth = 1;
+    Clock::time_point deadline;
+    bool timed = false;
+    bool aborted = false;
+
+    SearchStats stats;
+
+    const RotationSystem* rotationSystem = &RotationSystems::SRS;
+
+    // Static score of a board, line clears come in through the reward
+    [[nodiscard]] double boardScore(const Rows& rows) const {
+        return bot.score(extractFeatures<Grid>(rows, 0));
+    }
+
+    // Lists the placements for type and fills the ply's beam with the best beamWidth of them,
+    // best first. Returns the beam size, 0 if the piece can't even spawn.
+    int fillBeam(const Rows& rows, const std::uint64_t hash, const BlockType type, const int rotation,
+                 const Point start, const double reward, const int ply) {
+        Ply& scratch = plies[ply];
+        const int count = Search::enumerate(rows, type, rotation, start, *rotationSystem,
+                                            scratch.placements.template first<Search::MAX_PLACEMENTS>());
+        const int width = static_cast<int>(scratch.beam.size());
+
+        int size = 0;
+        for (int i = 0; i < count; i++) {
+            Child child;
+            child.placement = scratch.placements[i];
+            child.rows = rows;
+            child.hash = hash;
+
+            const int linesCleared = Search::land(child.rows, child.placement, child.hash);
+            child.reward = reward + bot.score(BoardFeatures{.linesCleared = linesCleared});
+            child.score = child.reward + boardScore(child.rows);
+            stats.nodes++;
+
+            // insertion into the sorted beam, the worst one falls off the end
+            if (size < width) {
+                size++;
+            } else if (child.score <= scratch.beam[size - 1].score) {
+                continue;
+            }
+
+            int slot = size - 1;
+            while (slot > 0 && scratch.beam[slot - 1].score < child.score) {
+                scratch.beam[slot] = scratch.beam[slot - 1];
+                slot--;
+            }
+            scratch.beam[slot] = child;
+        }
+
+        return size;
+    }
+
+    // Best value reachable from this child's board with the pieces from ply on
+    double expand(const Child& child, const int ply) {
+        if (ply == depth) {
+            return child.score;
+        }
+
+        if (timed && Clock::now() >= deadline) {
+            aborted = true;
+            return child.score;
+        }
+
+        if (ply < knownCount) {
+            return bestFor(child, known[ply], ply);
+        }
+
+        // nobody knows this piece yet, so average over all of them
+        double total = 0;
+        for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+            total += bestFor(child, static_cast<BlockType>(type), ply);
+        }
+        return total / PIECE_TYPE_COUNT;
+    }
+
+    // Best value of a freshly spawned piece of type on the child's board
+    double bestFor(const Child& child, const BlockType type, const int ply) {
+        const std::uint64_t key = TranspositionTable::key(child.hash, type, pieceIndex + ply);
+        const int remaining = depth - ply;
+
+        // values are stored without the reward that led here, the same board can be reached with any
+        const TranspositionEntry* entry = table.probe(key);
+        if (entry != nullptr && entry->depth >= remaining) {
+            return child.reward + entry->value;
+        }
+
+        const int size = fillBeam(child.rows, child.hash, type, 0, BasicGameState<Grid>::SPAWN_POSITION,
+                                  child.reward, ply);
+        if (size == 0) {
+            return LOSS;
+        }
+
+        auto& beam = plies[ply].beam;
+
+        // a shallower search of this position already knows a good placement, look at it first
+        if (entry != nullptr) {
+            for (int i = 1; i < size; i++) {
+                const Placement& placement = beam[i].placement;
+                if (placement.rotation == entry->rotation && placement.position.x == entry->x &&
+                    placement.position.y == entry->y) {
+                    std::rotate(beam.begin(), beam.begin() + i, beam.begin() + i + 1);
+                    break;
+                }
+            }
+        }
+
+        int bestIndex = 0;
+        double best = beam[0].score;
+
+        // the last piece looked at needs no recursion, its static scores are the values
+        if (ply < depth - 1) {
+            best = LOSS;
+            for (int i = 0; i < size && !aborted; i++) {
+                const double value = expand(beam[i], ply + 1);
+                if (value > best) {
+                    best = value;
+                    bestIndex = i;
+                }
+            }
+        } else {
+            for (int i = 1; i < size; i++) {
+                if (beam[i].score > best) {
+                    best = beam[i].score;
+                    bestIndex = i;
+                }
+            }
+        }
+
+        if (!aborted) {
+            table.store(key, best - child.reward, remaining, beam[bestIndex].placement);
+        }
+
+        return best;
+    }
+
+public:
+    explicit BasicLookahead(const LookaheadConfig& config = {}, const BotWeights& weights = {})
+        : bot(weights), config(config), table(config.tableMegabytes) {
+    }
+
+    void setConfig(const LookaheadConfig& newConfig) {
+        if (newConfig.tableMegabytes != config.tableMegabytes) {
+            table.resize(newConfig.tableMegabytes);
+        }
+        config = newConfig;
+    }
+
+    // The best placement for the block, with preview holding the pieces after it.
+    // pieceIndex counts the pieces placed before this one in the game.
+    std::optional<Placement> choose(const Grid& grid, const BasicBlock<Grid>& block,
+                                    const std::span<const BlockType> preview, const std::uint64_t pieceIndex) {
+        const auto start = Clock::now();
+        timed = config.timeBudget.count() > 0;
+        deadline = start + config.timeBudget;
+        stats = {};
+
+        rotationSystem = &block.getRotationSystem();
+        this->pieceIndex = pieceIndex;
+
+        // last piece's scratch isn't needed anymore, the same memory serves this one
+        arena.reset();
+
+        const int maxDepth = std::clamp(config.maxDepth, 1, MAX_DEPTH);
+        const int beamWidth = std::max(config.beamWidth, 1);
+
+        plies = arena.allocateArray<Ply>(maxDepth);
+        for (Ply& ply : plies) {
+            ply.placements = arena.allocateArray<Placement>(Search::MAX_PLACEMENTS);
+            ply.beam = arena.allocateArray<Child>(beamWidth);
+        }
+
+        known = arena.allocateArray<BlockType>(maxDepth);
+        knownCount = 0;
+        known[knownCount++] = block.getType();
+        for (const BlockType type : preview) {
+            if (knownCount == maxDepth) {
+                break;
+            }
+            known[knownCount++] = type;
+        }
+
+        Rows rows;
+        const auto gridRows = grid.getRows();
+        std::copy(gridRows.begin(), gridRows.end(), rows.begin());
+
+        // The root's beam doesn't change between depths, only the order it gets searched in
+        const int size = fillBeam(rows, grid.getHash(), block.getType(), block.getRotation(), block.getPosition(),
+                                  0, 0);
+        if (size == 0) {
+            return std::nullopt;
+        }
+
+        Ply& root = plies[0];
+        std::optional<Placement> best = root.beam[0].placement;
+        stats.depthReached = 1;
+
+        const std::span<double> values = arena.allocateArray<double>(size);
+
+        for (depth = 2; depth <= maxDepth; depth++) {
+            aborted = false;
+
+            int searched = 0;
+
+            for (; searched < size; searched++) {
+                values[searched] = expand(root.beam[searched], 1);
+                if (aborted) {
+                    break;
+                }
+            }
+
+            // root.beam[0] is last depth's best, so once it finished the partial result
+            // can only have found something better
+            if (searched == 0) {
+                break;
+            }
+
+            int bestIndex = 0;
+            for (int i = 1; i < searched; i++) {
+                if (values[i] > values[bestIndex]) {
+                    bestIndex = i;
+                }
+            }
+
+            best = root.beam[bestIndex].placement;
+            stats.depthReached = depth;
+
+            // search the new best first next time around
+            std::rotate(root.beam.begin(), root.beam.begin() + bestIndex, root.beam.begin() + bestIndex + 1);
+
+            if (aborted) {
+                break;
+            }
+        }
+
+        return best;
+    }
+
+    // Picks a placement and writes the moves that play it, returns how many.
+    // Without any placement it just drops the block where it is.
+    int plan(const Grid& grid, const BasicBlock<Grid>& block, const std::span<const BlockType> preview,
+             const std::uint64_t pieceIndex, const std::span<BlockMove, Search::MAX_MOVES> moves) {
+        const auto placement = choose(grid, block, preview, pieceIndex);
+
+        const int count = placement.has_value()
+                              ? Search::movesFor(grid, block.getType(), block.getRotation(), block.getPosition(),
+                                                 block.getRotationSystem(), *placement, moves)
+                              : -1;
+
+        if (count < 0) {
+            moves[0] = BlockMove::QUICK_DOWN;
+            return 1;
+        }
+
+        return count;
+    }
+
+    [[nodiscard]] const SearchStats& getStats() const {
+        return stats;
+    }
+
+    [[nodiscard]] const TranspositionTable::Stats& getTableStats() const {
+        return table.getStats();
+    }
+
+    [[nodiscard]] const SearchArena::Stats& getArenaStats() const {
+        return arena.getStats();
+    }
+
+    // Forgets every stored position, for starting a new game
+    void clearTable() {
+        table.clear();
+    }
+};
+
+using Lookahead = BasicLookahead<GameGrid>;
+
+
+#endif //SIMPLETETRIS_LOOKAHEAD_H
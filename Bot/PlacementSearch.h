@@ -0,0 +1,277 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_PLACEMENTSEARCH_H
+#define SIMPLETETRIS_PLACEMENTSEARCH_H
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "enums.h"
+#include "Reachability.h"
+#include "Blocks/PieceTables.h"
+#include "Blocks/RotationSystem.h"
+#include "GameManager/Zobrist.h"
+
+// Where a piece comes to rest
+struct Placement {
+    BlockType type;
+    int rotation;
+    // top-left of the box once it landed
+    Point position;
+};
+
+// Lists every resting placement a piece can reach from where it is, tucks and spins
+// included, and finds the moves that get it there. Works on the grid's row masks only,
+// so trying one placement is a handful of ANDs instead of moving a Block around.
+template <typename Grid>
+class BasicPlacementSearch {
+public:
+    using RowMask = typename Grid::RowMask;
+    using Rows = std::array<RowMask, Grid::HEIGHT>;
+    using Reachability = BasicReachability<Grid>;
+
+    // every orientation resting at every position, no board gets near that
+    static constexpr int MAX_PLACEMENTS = ROTATION_COUNT * Reachability::ROWS * (Grid::WIDTH + Grid::WALL_BITS);
+
+    // longest path movesFor() hands out, plenty for any sensible route
+    static constexpr int MAX_MOVES = 2 * (Grid::WIDTH + Grid::HEIGHT);
+
+private:
+    // box positions the path search can visit, one per bit of the reachability planes
+    static constexpr int STATES = ROTATION_COUNT * Reachability::ROWS * Reachability::POSITION_BITS;
+    static_assert(STATES <= 65536, "path search indexes states with 16 bits");
+
+    static constexpr int stateIndex(const int rotation, const Point position) {
+        return (rotation * Reachability::ROWS + position.y + Reachability::ROW_OFFSET) * Reachability::POSITION_BITS
+               + position.x + Grid::WALL_BITS;
+    }
+
+    // Turn, slide and hard drop like a player without finesse would, most placements get
+    // there this way. Returns the move count or -1 if the piece ends up somewhere else.
+    static int directMoves(const Grid& grid, const BlockType type, int rotation, Point position,
+                           const RotationSystem& rotationSystem, const Placement& target,
+                           const std::span<BlockMove, MAX_MOVES> moves) {
+        int count = 0;
+
+        const int turns = (target.rotation - rotation) & (ROTATION_COUNT - 1);
+        if (turns == 3) {
+            if (!rotationSystem.tryRotate(grid, type, rotation, position, RotationDirection::COUNTER_CLOCKWISE)) {
+                return -1;
+            }
+            moves[count++] = BlockMove::ROTATE_CCW;
+        } else {
+            for (int turn = 0; turn < turns; turn++) {
+                if (!rotationSystem.tryRotate(grid, type, rotation, position, RotationDirection::CLOCKWISE)) {
+                    return -1;
+                }
+                moves[count++] = BlockMove::ROTATE;
+            }
+        }
+
+        const PieceShape& shape = pieceShape(type, rotation);
+        const int step = target.position.x < position.x ? -1 : 1;
+        while (position.x != target.position.x) {
+            if (count >= MAX_MOVES - 1 || !grid.fits(shape, {position.x + step, position.y})) {
+                return -1;
+            }
+            position.x += step;
+            moves[count++] = step < 0 ? BlockMove::LEFT : BlockMove::RIGHT;
+        }
+
+        if (position.y + grid.dropDistance(shape, position) != target.position.y) {
+            return -1;
+        }
+
+        moves[count++] = BlockMove::QUICK_DOWN;
+        return count;
+    }
+
+    // Breadth first over single moves for placements that need a tuck or a spin.
+    // Returns the move count or -1 if there is no path short enough.
+    static int searchedMoves(const Grid& grid, const BlockType type, const int startRotation, const Point start,
+                             const RotationSystem& rotationSystem, const Placement& target,
+                             const std::span<BlockMove, MAX_MOVES> moves) {
+        struct Node {
+            int rotation;
+            Point position;
+        };
+
+        std::array<Node, STATES> queue;
+        std::array<std::uint16_t, STATES> parent;
+        std::array<BlockMove, STATES> via;
+        std::array<bool, STATES> visited{};
+
+        int head = 0;
+        int tail = 0;
+
+        const int startIndex = stateIndex(startRotation, start);
+        const int targetIndex = stateIndex(target.rotation, target.position);
+
+        visited[startIndex] = true;
+        queue[tail++] = {startRotation, start};
+
+        while (head < tail && !visited[targetIndex]) {
+            const Node node = queue[head++];
+            const int nodeIndex = stateIndex(node.rotation, node.position);
+
+            const auto visit = [&](const Node next, const BlockMove move) {
+                const int index = stateIndex(next.rotation, next.position);
+                if (!visited[index]) {
+                    visited[index] = true;
+                    parent[index] = static_cast<std::uint16_t>(nodeIndex);
+                    via[index] = move;
+                    queue[tail++] = next;
+                }
+            };
+
+            const PieceShape& shape = pieceShape(type, node.rotation);
+
+            for (const BlockMove move : {BlockMove::LEFT, BlockMove::RIGHT, BlockMove::DOWN}) {
+                Point next = node.position;
+                next.x += move == BlockMove::LEFT ? -1 : (move == BlockMove::RIGHT ? 1 : 0);
+                next.y += move == BlockMove::DOWN ? 1 : 0;
+
+                if (grid.fits(shape, next)) {
+                    visit({node.rotation, next}, move);
+                }
+            }
+
+            for (const RotationDirection direction : {RotationDirection::CLOCKWISE, RotationDirection::COUNTER_CLOCKWISE}) {
+                int rotation = node.rotation;
+                Point position = node.position;
+
+                if (rotationSystem.tryRotate(grid, type, rotation, position, direction)) {
+                    visit({rotation, position},
+                          direction == RotationDirection::CLOCKWISE ? BlockMove::ROTATE : BlockMove::ROTATE_CCW);
+                }
+            }
+        }
+
+        if (!visited[targetIndex]) {
+            return -1;
+        }
+
+        // walk back to the start, then flip the moves into order
+        int count = 0;
+        for (int index = targetIndex; index != startIndex; index = parent[index]) {
+            if (count >= MAX_MOVES - 1) {
+                return -1;
+            }
+            moves[count++] = via[index];
+        }
+
+        for (int i = 0; i < count / 2; i++) {
+            std::swap(moves[i], moves[count - 1 - i]);
+        }
+
+        // already resting, this just locks it
+        moves[count++] = BlockMove::QUICK_DOWN;
+        return count;
+    }
+
+    // Shared by both land()s, Hashed keeps the Zobrist hash up to date
+    template <bool Hashed>
+    static int landRows(Rows& rows, const Placement& placement, std::uint64_t& hash) {
+        const PieceShape& shape = pieceShape(placement.type, placement.rotation);
+
+        if constexpr (Hashed) {
+            for (const auto& cell : shape.cells) {
+                hash ^= Zobrist::CELL_KEYS<Grid::WIDTH, Grid::HEIGHT>[placement.position.y + cell.y]
+                                                                     [placement.position.x + cell.x];
+            }
+        }
+
+        bool anyFull = false;
+        for (int dy = shape.minY; dy <= shape.maxY; dy++) {
+            RowMask& row = rows[placement.position.y + dy];
+            row |= Grid::pieceRow(shape, dy, placement.position.x);
+            anyFull |= row == Grid::FULL_ROW;
+        }
+
+        if (!anyFull) {
+            return 0;
+        }
+
+        // single bottom-up compaction, same as the grid does
+        int writeRow = Grid::HEIGHT - 1;
+        for (int readRow = Grid::HEIGHT - 1; readRow >= 0; readRow--) {
+            if (rows[readRow] != Grid::FULL_ROW) {
+                rows[writeRow--] = rows[readRow];
+            }
+        }
+
+        const int rowsCleared = writeRow + 1;
+        for (; writeRow >= 0; writeRow--) {
+            rows[writeRow] = Grid::EMPTY_ROW;
+        }
+
+        // most rows moved, hashing them again is as cheap as tracking the moves
+        if constexpr (Hashed) {
+            hash = Grid::hashRows(rows);
+        }
+
+        return rowsCleared;
+    }
+
+public:
+    // Fills placements for the piece at start on a board given by its row masks, returns how many
+    static int enumerate(const typename Reachability::GridRows rows, const BlockType type, const int startRotation,
+                         const Point start, const RotationSystem& rotationSystem,
+                         const std::span<Placement, MAX_PLACEMENTS> placements) {
+        Reachability reachability;
+        reachability.compute(rows, type, startRotation, start, rotationSystem);
+
+        int count = 0;
+
+        for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+            // orientations that look like an earlier one (all of the O's) rest in the same spots
+            bool seen = false;
+            for (int earlier = 0; earlier < rotation; earlier++) {
+                seen |= pieceShape(type, earlier).rowMasks == pieceShape(type, rotation).rowMasks;
+            }
+            if (seen) {
+                continue;
+            }
+
+            for (int y = -Reachability::ROW_OFFSET; y < Grid::HEIGHT; y++) {
+                for (auto resting = reachability.resting(rotation, y); resting != 0; resting &= resting - 1) {
+                    const int x = std::countr_zero(resting) - Grid::WALL_BITS;
+                    placements[count++] = {type, rotation, {x, y}};
+                }
+            }
+        }
+
+        return count;
+    }
+
+    // Locks the placement into a copy of the rows and clears full ones, returns the rows cleared
+    static int land(Rows& rows, const Placement& placement) {
+        std::uint64_t unused = 0;
+        return landRows<false>(rows, placement, unused);
+    }
+
+    // Same, and keeps the board's Zobrist hash in step
+    static int land(Rows& rows, const Placement& placement, std::uint64_t& hash) {
+        return landRows<true>(rows, placement, hash);
+    }
+
+    // The moves that take the piece from its start to the placement, ending in the hard drop
+    // that locks it. Returns how many it wrote, -1 if the placement can't be reached.
+    static int movesFor(const Grid& grid, const BlockType type, const int startRotation, const Point start,
+                        const RotationSystem& rotationSystem, const Placement& target,
+                        const std::span<BlockMove, MAX_MOVES> moves) {
+        const int count = directMoves(grid, type, startRotation, start, rotationSystem, target, moves);
+        if (count >= 0) {
+            return count;
+        }
+
+        return searchedMoves(grid, type, startRotation, start, rotationSystem, target, moves);
+    }
+};
+
+
+#endif //SIMPLETETRIS_PLACEMENTSEARCH_H
@@ -0,0 +1,184 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_REACHABILITY_H
+#define SIMPLETETRIS_REACHABILITY_H
+#include <array>
+#include <span>
+
+#include "enums.h"
+#include "Blocks/PieceTables.h"
+#include "Blocks/RotationSystem.h"
+
+// Every box position a piece can get to from where it is with left, right, soft drop and
+// kicked rotations, as one bit mask per orientation and row. Box position (x, y) is bit
+// (x + WALL_BITS) of rows[rotation][y + ROW_OFFSET], the same bit layout the grid rows use.
+//
+// Everything is done a whole row of positions at a time: the positions a piece fits at
+// come from ORing shifted grid rows, sideways moves are an occluded fill along the row,
+// soft drops AND a row into the one below and every kick is one shift and AND.
+template <typename Grid>
+class BasicReachability {
+public:
+    using PositionMask = typename Grid::RowMask;
+
+    // the box can stick out above the grid by up to 3 rows (a flat I in the bottom of its box)
+    static constexpr int ROW_OFFSET = 3;
+    static constexpr int ROWS = Grid::HEIGHT + ROW_OFFSET;
+
+    static constexpr int POSITION_BITS = sizeof(PositionMask) * 8;
+
+    // x from -WALL_BITS up to WIDTH - 1, anything further right can't hold a piece
+    static constexpr PositionMask VALID_POSITIONS =
+        static_cast<PositionMask>((PositionMask{1} << (Grid::WIDTH + Grid::WALL_BITS)) - 1);
+
+    using Plane = std::array<PositionMask, ROWS>;
+    using GridRows = std::span<const typename Grid::RowMask, Grid::HEIGHT>;
+
+private:
+    // where each orientation fits
+    std::array<Plane, ROTATION_COUNT> freePositions{};
+    // where each orientation can get to
+    std::array<Plane, ROTATION_COUNT> reached{};
+
+    static constexpr PositionMask shifted(const PositionMask mask, const int by) {
+        return static_cast<PositionMask>(by >= 0 ? mask << by : mask >> -by);
+    }
+
+    // Bit b of a row is set if the box fits with its left edge at bit b
+    static void computeFree(const GridRows rows, const PieceShape& shape, Plane& free) {
+        for (int i = 0; i < ROWS; i++) {
+            const int y = i - ROW_OFFSET;
+            PositionMask blocked = 0;
+
+            for (int dy = shape.minY; dy <= shape.maxY; dy++) {
+                const int gridY = y + dy;
+                if (gridY < 0 || gridY >= Grid::HEIGHT) {
+                    blocked = static_cast<PositionMask>(~PositionMask{0});
+                    break;
+                }
+
+                // a cell dx to the right collides where the grid row, moved dx back, has a bit
+                for (int dx = 0; dx < 4; dx++) {
+                    if (shape.rowMasks[dy] & (1u << dx)) {
+                        blocked |= static_cast<PositionMask>(rows[gridY] >> dx);
+                    }
+                }
+            }
+
+            free[i] = static_cast<PositionMask>(~blocked & VALID_POSITIONS);
+        }
+    }
+
+    // Spreads the positions in a row sideways as far as the free positions let them
+    static constexpr PositionMask spreadSideways(const PositionMask from, const PositionMask free) {
+        PositionMask left = from;
+        PositionMask right = from;
+        PositionMask openLeft = free;
+        PositionMask openRight = free;
+
+        // Kogge-Stone occluded fill, doubling the reach each round
+        for (int step = 1; step < POSITION_BITS; step <<= 1) {
+            left |= openLeft & shifted(left, step);
+            openLeft &= shifted(openLeft, step);
+
+            right |= openRight & shifted(right, -step);
+            openRight &= shifted(openRight, -step);
+        }
+
+        return static_cast<PositionMask>(left | right);
+    }
+
+public:
+    // Floods out from the piece at start until nothing new turns up. Only needs the row
+    // masks, so search code can run it on boards that never were a Grid.
+    void compute(const GridRows rows, const BlockType type, const int startRotation, const Point start,
+                 const RotationSystem& rotationSystem = RotationSystems::SRS) {
+        for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+            computeFree(rows, pieceShape(type, rotation), freePositions[rotation]);
+            reached[rotation].fill(0);
+        }
+
+        const int startRow = start.y + ROW_OFFSET;
+        const PositionMask startBit = shifted(1, start.x + Grid::WALL_BITS);
+        if (startRow < 0 || startRow >= ROWS || !(freePositions[startRotation & (ROTATION_COUNT - 1)][startRow] & startBit)) {
+            return;
+        }
+        reached[startRotation & (ROTATION_COUNT - 1)][startRow] = startBit;
+
+        // rotations can kick a piece back up, so go again until a pass adds nothing
+        bool changed = true;
+        while (changed) {
+            changed = false;
+
+            for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+                Plane& reach = reached[rotation];
+                const Plane& free = freePositions[rotation];
+
+                // top to bottom, so one pass carries soft drops all the way down
+                for (int i = 0; i < ROWS; i++) {
+                    PositionMask row = reach[i];
+                    if (i > 0) {
+                        row |= reach[i - 1] & free[i];
+                    }
+                    row = spreadSideways(row, free[i]);
+
+                    if (row != reach[i]) {
+                        reach[i] = row;
+                        changed = true;
+                    }
+                }
+
+                for (const RotationDirection direction : {RotationDirection::CLOCKWISE, RotationDirection::COUNTER_CLOCKWISE}) {
+                    const int toRotation = RotationSystem::rotatedIndex(rotation, direction);
+                    const KickTable& table = rotationSystem.kicksFor(type, rotation, direction);
+
+                    Plane& toReach = reached[toRotation];
+                    const Plane& toFree = freePositions[toRotation];
+
+                    for (int i = 0; i < ROWS; i++) {
+                        // positions that haven't found a kick that fits yet
+                        PositionMask pending = reach[i];
+
+                        for (int k = 0; k < table.count && pending != 0; k++) {
+                            const Point kick = table.offsets[k];
+                            const int j = i + kick.y;
+                            if (j < 0 || j >= ROWS) {
+                                continue;
+                            }
+
+                            const PositionMask landed = static_cast<PositionMask>(shifted(pending, kick.x) & toFree[j]);
+                            if ((toReach[j] | landed) != toReach[j]) {
+                                toReach[j] |= landed;
+                                changed = true;
+                            }
+
+                            // those turned with this kick and never try the later ones
+                            pending &= static_cast<PositionMask>(~shifted(toFree[j], -kick.x));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Positions reachable in row y (box top) for rotation
+    [[nodiscard]] PositionMask reachable(const int rotation, const int y) const {
+        return reached[rotation][y + ROW_OFFSET];
+    }
+
+    // Reachable positions that can't fall any further, where the piece can lock
+    [[nodiscard]] PositionMask resting(const int rotation, const int y) const {
+        const int i = y + ROW_OFFSET;
+        const PositionMask below = i + 1 < ROWS ? freePositions[rotation][i + 1] : PositionMask{0};
+        return static_cast<PositionMask>(reached[rotation][i] & ~below);
+    }
+
+    [[nodiscard]] bool isReachable(const int rotation, const Point position) const {
+        return (reachable(rotation, position.y) & shifted(1, position.x + Grid::WALL_BITS)) != 0;
+    }
+};
+
+
+#endif //SIMPLETETRIS_REACHABILITY_H
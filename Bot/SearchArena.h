@@ -0,0 +1,121 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_SEARCHARENA_H
+#define SIMPLETETRIS_SEARCHARENA_H
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator for search scratch: beams, boards, placement and move lists.
+// Allocating is a pointer bump, freeing does nothing, and reset() hands everything back
+// at once while keeping the memory, so after the first few searches it never goes to
+// the system again. One per searching thread, it isn't thread safe.
+// Also a std::pmr::memory_resource, so pmr containers can live in it.
+class SearchArena : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        // handed out since the last reset
+        std::size_t bytesInUse = 0;
+        // most bytes in use between two resets
+        std::size_t peakBytes = 0;
+        // owned memory, used or not
+        std::size_t capacity = 0;
+        // times the arena had to go to the system for more
+        std::uint64_t systemAllocations = 0;
+        std::uint64_t resets = 0;
+    };
+
+private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> memory;
+        std::size_t size;
+    };
+
+    std::vector<Chunk> chunks;
+    // chunk being bumped through and how far into it
+    std::size_t current = 0;
+    std::size_t offset = 0;
+
+    std::size_t chunkSize;
+
+    Stats stats;
+
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        while (true) {
+            if (current < chunks.size()) {
+                Chunk& chunk = chunks[current];
+
+                const auto base = reinterpret_cast<std::uintptr_t>(chunk.memory.get());
+                const std::size_t aligned = (base + offset + alignment - 1) / alignment * alignment - base;
+
+                if (aligned + bytes <= chunk.size) {
+                    stats.bytesInUse += aligned + bytes - offset;
+                    stats.peakBytes = std::max(stats.peakBytes, stats.bytesInUse);
+                    offset = aligned + bytes;
+                    return chunk.memory.get() + aligned;
+                }
+
+                // doesn't fit, the rest of this chunk stays unused until the next reset
+                current++;
+                offset = 0;
+                continue;
+            }
+
+            // out of chunks, only happens while warming up
+            const std::size_t size = std::max(chunkSize, bytes + alignment);
+            chunks.push_back({std::make_unique<std::byte[]>(size), size});
+            stats.capacity += size;
+            stats.systemAllocations++;
+
+            // later chunks grow so a big search settles into few of them
+            chunkSize *= 2;
+        }
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {
+        // everything comes back at once in reset()
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit SearchArena(const std::size_t initialBytes = 256 * 1024) : chunkSize(initialBytes) {
+    }
+
+    SearchArena(const SearchArena&) = delete;
+    SearchArena& operator=(const SearchArena&) = delete;
+
+    // Room for count default constructed Ts. They are never destroyed, so only plain data goes in here.
+    template <typename T>
+    std::span<T> allocateArray(const std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "the arena never runs destructors");
+
+        T* memory = static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+        std::uninitialized_default_construct_n(memory, count);
+        return {memory, count};
+    }
+
+    // Frees everything handed out so far, the memory stays for the next round
+    void reset() {
+        current = 0;
+        offset = 0;
+        stats.bytesInUse = 0;
+        stats.resets++;
+    }
+
+    [[nodiscard]] const Stats& getStats() const {
+        return stats;
+    }
+};
+
+
+#endif //SIMPLETETRIS_SEARCHARENA_H
@@ -0,0 +1,154 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_TRANSPOSITIONTABLE_H
+#define SIMPLETETRIS_TRANSPOSITIONTABLE_H
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PlacementSearch.h"
+#include "GameManager/Zobrist.h"
+
+// What the search remembers about one board with one piece to place
+struct TranspositionEntry {
+    std::uint64_t key = 0;
+    // best value found, relative to the board (line clears before it not included)
+    float value = 0;
+    // pieces searched from here, 0 marks an empty slot
+    std::uint8_t depth = 0;
+
+    // the best placement found
+    std::uint8_t rotation = 0;
+    std::int8_t x = 0;
+    std::int8_t y = 0;
+};
+
+static_assert(sizeof(TranspositionEntry) == 16);
+
+// Fixed size hash table of search results. Each key maps to one bucket of four entries
+// that fills exactly one cache line, so a probe costs a single cache miss at most.
+// A full bucket gives up its shallowest entry.
+class TranspositionTable {
+public:
+    static constexpr int BUCKET_ENTRIES = 4;
+
+    struct alignas(64) Bucket {
+        std::array<TranspositionEntry, BUCKET_ENTRIES> entries{};
+    };
+
+    static_assert(sizeof(Bucket) == 64);
+
+    struct Stats {
+        std::uint64_t probes = 0;
+        std::uint64_t hits = 0;
+        std::uint64_t stores = 0;
+
+        [[nodiscard]] double hitRate() const {
+            return probes > 0 ? static_cast<double>(hits) / probes : 0.0;
+        }
+    };
+
+private:
+    std::vector<Bucket> buckets;
+    std::uint64_t bucketMask = 0;
+
+    Stats stats;
+
+    Bucket& bucketFor(const std::uint64_t key) {
+        return buckets[key & bucketMask];
+    }
+
+public:
+    // Rounds the size down to a power of two buckets, 0 turns the table off
+    explicit TranspositionTable(const std::size_t megabytes = 4) {
+        resize(megabytes);
+    }
+
+    void resize(const std::size_t megabytes) {
+        const std::size_t wanted = megabytes * 1024 * 1024 / sizeof(Bucket);
+        buckets.assign(wanted > 0 ? std::bit_floor(wanted) : 0, Bucket{});
+        bucketMask = buckets.empty() ? 0 : buckets.size() - 1;
+    }
+
+    // A search position: the board, the piece about to be placed and its place in the piece sequence
+    static constexpr std::uint64_t key(const std::uint64_t boardHash, const BlockType piece,
+                                       const std::uint64_t queueIndex) {
+        return boardHash ^ Zobrist::pieceKey(piece) ^ Zobrist::queueKey(queueIndex);
+    }
+
+    // The entry stored for key, nullptr if there is none
+    const TranspositionEntry* probe(const std::uint64_t key) {
+        if (buckets.empty()) {
+            return nullptr;
+        }
+
+        stats.probes++;
+
+        for (const auto& entry : bucketFor(key).entries) {
+            if (entry.depth != 0 && entry.key == key) {
+                stats.hits++;
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void store(const std::uint64_t key, const double value, const int depth, const Placement& best) {
+        if (buckets.empty()) {
+            return;
+        }
+
+        stats.stores++;
+
+        // same key first, anywhere in the bucket, so a position never ends up in two slots
+        auto& entries = bucketFor(key).entries;
+        TranspositionEntry* slot = nullptr;
+
+        for (auto& entry : entries) {
+            if (entry.depth != 0 && entry.key == key) {
+                slot = &entry;
+                break;
+            }
+        }
+
+        if (slot != nullptr) {
+            // a shallower result never replaces a deeper one for the same position
+            if (slot->depth > depth) {
+                return;
+            }
+        } else {
+            // otherwise an empty slot, then the shallowest one
+            slot = &entries[0];
+            for (auto& entry : entries) {
+                if (entry.depth == 0) {
+                    slot = &entry;
+                    break;
+                }
+                if (entry.depth < slot->depth) {
+                    slot = &entry;
+                }
+            }
+        }
+
+        *slot = {key, static_cast<float>(value), static_cast<std::uint8_t>(depth),
+                 static_cast<std::uint8_t>(best.rotation),
+                 static_cast<std::int8_t>(best.position.x), static_cast<std::int8_t>(best.position.y)};
+    }
+
+    void clear() {
+        std::fill(buckets.begin(), buckets.end(), Bucket{});
+    }
+
+    [[nodiscard]] const Stats& getStats() const {
+        return stats;
+    }
+};
+
+
+#endif //SIMPLETETRIS_TRANSPOSITIONTABLE_H
@@ -0,0 +1,35 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local std::size_t allocationCount = 0;
+}
+
+std::size_t AllocationCounter::threadAllocations() {
+    return allocationCount;
+}
+
+// Replacement global allocation functions, array and nothrow forms forward here
+void* operator new(const std::size_t size) {
+    allocationCount++;
+
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
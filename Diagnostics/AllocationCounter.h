@@ -0,0 +1,18 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_ALLOCATIONCOUNTER_H
+#define SIMPLETETRIS_ALLOCATIONCOUNTER_H
+#include <cstddef>
+
+// Counts heap allocations per thread. The counting operator new lives in
+// AllocationCounter.cpp, so this only reports real numbers in targets that link it.
+class AllocationCounter {
+public:
+    // Number of operator new calls made by the calling thread so far
+    static std::size_t threadAllocations();
+};
+
+
+#endif //SIMPLETETRIS_ALLOCATIONCOUNTER_H
@@ -0,0 +1,74 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_BOARDSNAPSHOT_H
+#define SIMPLETETRIS_BOARDSNAPSHOT_H
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "enums.h"
+#include "GameGrid.h"
+
+// The optional half of a snapshot, empty without colors so it takes no space as a base
+template <typename Grid, bool WithColors>
+struct SnapshotColors {
+    typename Grid::ColorPlane colors;
+
+    bool operator==(const SnapshotColors&) const = default;
+};
+
+template <typename Grid>
+struct SnapshotColors<Grid, false> {
+    bool operator==(const SnapshotColors&) const = default;
+};
+
+// A board as plain data: just the row masks, plus the color plane if WithColors.
+// Trivially copyable and fixed size, so it can be memcpy'd, hashed, kept in bulk or sent
+// to another thread or process as is. Use BoardSnapshot and ColoredBoardSnapshot for the
+// standard board.
+template <typename Grid, bool WithColors>
+struct BasicBoardSnapshot : SnapshotColors<Grid, WithColors> {
+    // one mask per row (row 0 is the top) in the grid's layout, wall bits included
+    std::array<typename Grid::RowMask, Grid::HEIGHT> rows;
+
+    static BasicBoardSnapshot fromGrid(const Grid& grid) {
+        BasicBoardSnapshot snapshot{};
+
+        const auto gridRows = grid.getRows();
+        std::copy(gridRows.begin(), gridRows.end(), snapshot.rows.begin());
+
+        if constexpr (WithColors) {
+            const auto gridColors = grid.getColors();
+            std::copy(gridColors.begin(), gridColors.end(), snapshot.colors.begin());
+        }
+
+        return snapshot;
+    }
+
+    // Loads the snapshot into grid. Without colors every filled cell gets fillColor.
+    void toGrid(Grid& grid, const BlockColor fillColor = BlockColor::BLUE) const {
+        if constexpr (WithColors) {
+            grid.load(rows, this->colors);
+        } else {
+            grid.load(rows, fillColor);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t hash() const {
+        return Grid::hashRows(rows);
+    }
+
+    bool operator==(const BasicBoardSnapshot&) const = default;
+};
+
+using BoardSnapshot = BasicBoardSnapshot<GameGrid, false>;
+using ColoredBoardSnapshot = BasicBoardSnapshot<GameGrid, true>;
+
+static_assert(std::is_trivially_copyable_v<BoardSnapshot> && sizeof(BoardSnapshot) == 48);
+static_assert(std::is_trivially_copyable_v<ColoredBoardSnapshot>);
+
+
+#endif //SIMPLETETRIS_BOARDSNAPSHOT_H
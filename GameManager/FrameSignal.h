@@ -0,0 +1,61 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_FRAMESIGNAL_H
+#define SIMPLETETRIS_FRAMESIGNAL_H
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+// Lets a thread sleep until another one actually changed something, the render thread
+// waits on the simulation with it and the simulation waits on input.
+// Every notify() bumps a counter, waiters compare it with the last one they saw,
+// so a change made while nobody was waiting is never lost.
+class FrameSignal {
+
+    std::mutex mutex;
+    std::condition_variable changed;
+
+    std::uint64_t sequence = 0;
+    bool stopped = false;
+
+public:
+
+    // Something changed, wake the waiting thread
+    void notify() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            sequence++;
+        }
+        changed.notify_all();
+    }
+
+    // Wakes every waiter for good, waitForChange() stops blocking after this
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        changed.notify_all();
+    }
+
+    // Blocks until there was a notify() after lastSeen or stop() was called.
+    // Returns the sequence to pass in next time.
+    std::uint64_t waitForChange(const std::uint64_t lastSeen) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] { return stopped || sequence != lastSeen; });
+        return sequence;
+    }
+
+    // Same as waitForChange() but gives up at deadline
+    template <typename TimePoint>
+    std::uint64_t waitForChangeUntil(const std::uint64_t lastSeen, const TimePoint deadline) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait_until(lock, deadline, [&] { return stopped || sequence != lastSeen; });
+        return sequence;
+    }
+};
+
+
+#endif //SIMPLETETRIS_FRAMESIGNAL_H
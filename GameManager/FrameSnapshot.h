@@ -0,0 +1,37 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_FRAMESNAPSHOT_H
+#define SIMPLETETRIS_FRAMESNAPSHOT_H
+#include <array>
+#include <cstdint>
+
+#include "enums.h"
+#include "GameGrid.h"
+#include "Randomizer.h"
+
+// Everything the renderer needs for one frame, copied out of the game state
+// by the logic side so drawing never touches the live grid or block
+template <typename Grid>
+struct BasicFrameSnapshot {
+    typename Grid::ColorPlane colors{};
+
+    bool hasActiveBlock = false;
+    std::array<Point, 4> activePositions{};
+    // where the active block would land, drawn as a preview
+    std::array<Point, 4> ghostPositions{};
+    BlockColor activeColor = BlockColor::NONE;
+
+    // the next pieces out of the bag, first one spawns next
+    std::array<BlockType, BagRandomizer::MAX_PREVIEW> preview{};
+    int previewCount = 0;
+
+    // increases with every published frame
+    std::uint64_t sequence = 0;
+};
+
+using FrameSnapshot = BasicFrameSnapshot<GameGrid>;
+
+
+#endif //SIMPLETETRIS_FRAMESNAPSHOT_H
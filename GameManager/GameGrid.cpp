@@ -2,4 +2,10 @@
 // Created by sdalp on 12/16/2025.
 //
 
-#include "GameGrid.h"
\ No newline at end of file
+#include "GameGrid.h"
+
+// Compile the standard board and the wide training boards (32 bit and 64 bit rows)
+// here once, so a change that breaks one of the sizes fails the build right away
+template class BasicGameGrid<10, 24>;
+template class BasicGameGrid<16, 24>;
+template class BasicGameGrid<32, 24>;
@@ -4,65 +4,222 @@
 
 #ifndef SIMPLETETRIS_GAMEGRID_H
 #define SIMPLETETRIS_GAMEGRID_H
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 #include <vector>
 #include <enums.h>
 
+#include "Zobrist.h"
+#include "Blocks/PieceTables.h"
+
 struct ColorPosition {
     Point position;
     BlockColor color;
 };
 
-class GameGrid {
+// Smallest unsigned type with at least Bits bits
+template <int Bits>
+using UnsignedForBits = std::conditional_t<(Bits <= 16), std::uint16_t,
+                        std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>;
 
-    std::vector<std::vector<char>> grid{24, std::vector<char>(10, '.')};
+// The board, sized at compile time so row masks and loops fold into constants.
+// Use GameGrid for the standard 10x24 board.
+template <int Width, int Height>
+class BasicGameGrid {
 
-    // empty until game starts populating it
-    std::vector<ColorPosition> colorGrid{
+public:
+    static constexpr int WIDTH = Width;
+    static constexpr int HEIGHT = Height;
 
-    };
+    // Every row keeps a few always-set bits on both sides of the playfield,
+    // so a cell pushed past a wall collides the same way it would with a block
+    static constexpr int WALL_BITS = 3;
 
-    // Helper function to check if a position has a block
-    bool hasBlockAt(int x, int y) const {
-        for (const auto& colorPos : colorGrid) {
-            if (colorPos.position.x == x && colorPos.position.y == y) {
-                return true;
+    static_assert(WIDTH >= 4 && WIDTH + 2 * WALL_BITS <= 64, "a row has to fit a piece and a 64 bit mask");
+    static_assert(HEIGHT >= 4 && HEIGHT < 64, "a column has to fit a 64 bit mask with its floor bit");
+
+    // One bit per column, column x lives at bit (x + WALL_BITS).
+    // 16 bits for the standard board, wider boards get the next machine word.
+    using RowMask = UnsignedForBits<WIDTH + 2 * WALL_BITS>;
+
+    // bits above the right wall are treated as more wall
+    static constexpr RowMask FULL_ROW = static_cast<RowMask>(~RowMask{0});
+    static constexpr RowMask EMPTY_ROW = FULL_ROW & static_cast<RowMask>(~(((RowMask{1} << WIDTH) - 1) << WALL_BITS));
+
+    // the bits of a row that are actual cells
+    static constexpr RowMask PLAYFIELD = static_cast<RowMask>(~EMPTY_ROW);
+
+    // One color per cell, NONE means the cell is empty
+    using ColorPlane = std::array<std::array<BlockColor, WIDTH>, HEIGHT>;
+
+    // The same cells seen per column, bit y set if row y is filled. The bit just
+    // below the last row is always set so every column has a floor.
+    using ColumnMask = UnsignedForBits<HEIGHT + 1>;
+
+    static constexpr ColumnMask FLOOR_BIT = ColumnMask{1} << HEIGHT;
+
+    static constexpr RowMask columnBit(const int x) {
+        return static_cast<RowMask>(RowMask{1} << (x + WALL_BITS));
+    }
+
+    // Zobrist hash of the cells in row y, the board's hash is all rows XORed together
+    static constexpr std::uint64_t rowHash(const int y, const RowMask row) {
+        std::uint64_t hash = 0;
+        for (RowMask cells = row & PLAYFIELD; cells != 0; cells &= cells - 1) {
+            hash ^= Zobrist::CELL_KEYS<WIDTH, HEIGHT>[y][std::countr_zero(cells) - WALL_BITS];
+        }
+        return hash;
+    }
+
+    // Hashes a whole board from scratch, the grid itself keeps its hash up to date as it goes
+    static std::uint64_t hashRows(const std::span<const RowMask, HEIGHT> rows) {
+        std::uint64_t hash = 0;
+        for (int y = 0; y < HEIGHT; y++) {
+            hash ^= rowHash(y, rows[y]);
+        }
+        return hash;
+    }
+
+private:
+
+    // occupancy plane, one mask per row (row 0 is the top)
+    std::array<RowMask, HEIGHT> rows = emptyRows();
+
+    // color plane, parallel to rows; NONE means the cell is empty
+    ColorPlane colors{};
+
+    int lastRowsCleared = 0;
+
+    // Zobrist hash of the filled cells, kept up to date by setCell and line clears
+    std::uint64_t hash = 0;
+
+    // column plane, transposed copy of rows for drop distance lookups
+    std::array<ColumnMask, WIDTH> columns = emptyColumns();
+
+    static constexpr std::array<ColumnMask, WIDTH> emptyColumns() {
+        std::array<ColumnMask, WIDTH> result{};
+        result.fill(FLOOR_BIT);
+        return result;
+    }
+
+    // Recomputes the column plane from the rows, only needed after rows moved
+    void rebuildColumns() {
+        columns = emptyColumns();
+
+        for (int y = 0; y < HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                if (hasBlockAt(x, y)) {
+                    columns[x] |= ColumnMask{1} << y;
+                }
             }
         }
-        return false;
+    }
+
+    static constexpr std::array<RowMask, HEIGHT> emptyRows() {
+        std::array<RowMask, HEIGHT> result{};
+        result.fill(EMPTY_ROW);
+        return result;
+    }
+
+    static constexpr bool isInBounds(const Point position) {
+        return position.x >= 0 && position.x < WIDTH && position.y >= 0 && position.y < HEIGHT;
+    }
+
+    // Helper function to check if a position has a block
+    bool hasBlockAt(int x, int y) const {
+        return (rows[y] & columnBit(x)) != 0;
     }
 
     // Helper function to check if a row is completely filled
     bool isRowFilled(int row) const {
-        int width = grid[0].size();  // Should be 10
+        // wall bits are always set, so a full row is all ones
+        return rows[row] == FULL_ROW;
+    }
+
+    // Drops every full row at or above startRow in a single bottom-up pass.
+    // Rows below startRow never move, so callers pass the lowest full row they know of.
+    int compactFilledRows(const int startRow) {
+        int writeRow = startRow;
 
-        for (int x = 0; x < width; x++) {
-            if (!hasBlockAt(x, row)) {
-                return false;  // Found an empty spot
+        for (int readRow = startRow; readRow >= 0; readRow--) {
+            // a cleared row leaves the hash, a moved one swaps its keys for the ones a row lower
+            if (isRowFilled(readRow)) {
+                hash ^= rowHash(readRow, rows[readRow]);
+                continue;
             }
+
+            if (writeRow != readRow) {
+                hash ^= rowHash(readRow, rows[readRow]) ^ rowHash(writeRow, rows[readRow]);
+                rows[writeRow] = rows[readRow];
+                colors[writeRow] = colors[readRow];
+            }
+            writeRow--;
+        }
+
+        // whatever is left at the top is new empty space
+        const int rowsCleared = writeRow + 1;
+        for (; writeRow >= 0; writeRow--) {
+            rows[writeRow] = EMPTY_ROW;
+            colors[writeRow].fill(BlockColor::NONE);
         }
 
-        return true;  // All positions filled
+        rebuildColumns();
+
+        return rowsCleared;
     }
 
-    // Remove all blocks from a specific row
-    void removeRow(int row) {
-        // Use erase-remove idiom to remove all blocks in this row
-        colorGrid.erase(
-            std::remove_if(colorGrid. begin(), colorGrid.end(),
-                [row](const ColorPosition& cp) {
-                    return cp.position. y == row;
-                }),
-            colorGrid.end()
-        );
+    // Puts the full rows a placement cleared back where they were, the other rows of
+    // the compacted block move back up around them. Undoes compactFilledRows().
+    void reinsertClearedRows(const std::uint64_t clearedRows,
+                             const std::array<std::array<BlockColor, WIDTH>, 4>& clearedColors) {
+        const int lowestCleared = 63 - std::countl_zero(clearedRows);
+
+        // rows above the lowest cleared one got pushed down by this many
+        int readRow = std::popcount(clearedRows);
+        int restored = 0;
+
+        for (int row = 0; row <= lowestCleared; row++) {
+            if ((clearedRows >> row) & 1) {
+                rows[row] = FULL_ROW;
+                colors[row] = clearedColors[restored++];
+            } else {
+                rows[row] = rows[readRow];
+                colors[row] = colors[readRow];
+                readRow++;
+            }
+        }
     }
 
-    // Move all blocks above a certain row down by one
-    void moveRowsDown(int aboveRow) {
-        for (auto& colorPos : colorGrid) {
-            if (colorPos.position.y < aboveRow) {
-                colorPos.position.y++;
+    // Takes over rows as they are, colorAt(x, y) colors the filled cells
+    template <typename ColorAt>
+    void loadRows(const std::span<const RowMask, HEIGHT> newRows, const ColorAt& colorAt) {
+        for (int y = 0; y < HEIGHT; y++) {
+            rows[y] = newRows[y] | EMPTY_ROW;
+            for (int x = 0; x < WIDTH; x++) {
+                colors[y][x] = hasBlockAt(x, y) ? colorAt(x, y) : BlockColor::NONE;
             }
         }
+
+        rebuildColumns();
+        hash = hashRows(rows);
+        lastRowsCleared = 0;
+    }
+
+    void setCell(const Point position, const BlockColor color) {
+        if (!isInBounds(position)) {
+            return;
+        }
+
+        if (!hasBlockAt(position.x, position.y)) {
+            hash ^= Zobrist::CELL_KEYS<WIDTH, HEIGHT>[position.y][position.x];
+        }
+
+        rows[position.y] |= columnBit(position.x);
+        colors[position.y][position.x] = color;
+        columns[position.x] |= ColumnMask{1} << position.y;
     }
 
     // some kind of dynamic array of blocks with their positions
@@ -70,131 +227,306 @@ class GameGrid {
     public:
 
         int deleteFilledRows() {
-            int rowsCleared = 0;
-
-            // Check from bottom to top
-            for (int row = grid.size() - 1; row >= 0; row--) {
+            // Find the lowest full row, everything from there up gets compacted at once
+            for (int row = HEIGHT - 1; row >= 0; row--) {
                 if (isRowFilled(row)) {
-                    removeRow(row);
-                    moveRowsDown(row);
-                    rowsCleared++;
-
-                    // Check the same row again since blocks moved down
-                    row++;
+                    return compactFilledRows(row);
                 }
             }
 
-            return rowsCleared;
-            // Optional: return number of rows cleared for scoring
-            // return rowsCleared;
+            return 0;
         }
 
 
-        std::vector<std::vector<char>> getGrid() {
-            return grid;
+        // Read-only views straight into the grid planes, nothing gets copied.
+        // They stay valid as long as the grid does.
+        [[nodiscard]] std::span<const RowMask, HEIGHT> getRows() const {
+            return rows;
+        }
+
+        [[nodiscard]] std::span<const std::array<BlockColor, WIDTH>, HEIGHT> getColors() const {
+            return colors;
         }
 
-        std::vector<ColorPosition> getColorGrid() {
+        // Rebuilds the locked cells as a flat list from the color plane.
+        // Allocates, so keep it off the render path and use getColors() there.
+        std::vector<ColorPosition> getColorGrid() const {
+            std::vector<ColorPosition> colorGrid;
+
+            for (int y = 0; y < HEIGHT; y++) {
+                for (int x = 0; x < WIDTH; x++) {
+                    if (colors[y][x] != BlockColor::NONE) {
+                        colorGrid.push_back({{x, y}, colors[y][x]});
+                    }
+                }
+            }
+
             return colorGrid;
         }
 
+        [[nodiscard]] RowMask getRow(const int row) const {
+            return rows[row];
+        }
+
+        [[nodiscard]] BlockColor getColorAt(const Point position) const {
+            return colors[position.y][position.x];
+        }
+
+        void clear() {
+            rows = emptyRows();
+            columns = emptyColumns();
+            hash = 0;
+
+            for (auto& row : colors) {
+                row.fill(BlockColor::NONE);
+            }
+        }
+
+
+        // Replaces the whole board with rows (wall bits are put back regardless) and their colors
+        void load(const std::span<const RowMask, HEIGHT> newRows,
+                  const std::span<const std::array<BlockColor, WIDTH>, HEIGHT> newColors) {
+            loadRows(newRows, [&newColors](const int x, const int y) { return newColors[y][x]; });
+        }
+
+        // Same for rows without colors, every filled cell gets fillColor
+        void load(const std::span<const RowMask, HEIGHT> newRows, const BlockColor fillColor) {
+            loadRows(newRows, [fillColor](int, int) { return fillColor; });
+        }
+
 
         // Create some dummy data for testing
         void createDummyData() {
             // Clear any existing data
-            colorGrid.clear();
+            clear();
 
             // Bottom row (row 19) - mix of colors
-            colorGrid.push_back({{0, 19}, BlockColor::CYAN});
-            colorGrid.push_back({{1, 19}, BlockColor::YELLOW});
-            colorGrid.push_back({{2, 19}, BlockColor::PURPLE});
-            colorGrid.push_back({{3, 19}, BlockColor::GREEN});
-            colorGrid.push_back({{4, 19}, BlockColor::RED});
-            colorGrid.push_back({{5, 19}, BlockColor::BLUE});
-            colorGrid.push_back({{6, 19}, BlockColor:: ORANGE});
-            colorGrid.push_back({{7, 19}, BlockColor:: CYAN});
-            colorGrid.push_back({{8, 19}, BlockColor::YELLOW});
-            colorGrid.push_back({{9, 19}, BlockColor:: PURPLE});
+            setCell({0, 19}, BlockColor::CYAN);
+            setCell({1, 19}, BlockColor::YELLOW);
+            setCell({2, 19}, BlockColor::PURPLE);
+            setCell({3, 19}, BlockColor::GREEN);
+            setCell({4, 19}, BlockColor::RED);
+            setCell({5, 19}, BlockColor::BLUE);
+            setCell({6, 19}, BlockColor:: ORANGE);
+            setCell({7, 19}, BlockColor:: CYAN);
+            setCell({8, 19}, BlockColor::YELLOW);
+            setCell({9, 19}, BlockColor:: PURPLE);
 
             // Row 18 - alternating cyan blocks
-            colorGrid.push_back({{0, 18}, BlockColor:: CYAN});
-            colorGrid.push_back({{2, 18}, BlockColor:: CYAN});
-            colorGrid.push_back({{4, 18}, BlockColor::CYAN});
-            colorGrid.push_back({{6, 18}, BlockColor::CYAN});
-            colorGrid.push_back({{8, 18}, BlockColor::CYAN});
+            setCell({0, 18}, BlockColor:: CYAN);
+            setCell({2, 18}, BlockColor:: CYAN);
+            setCell({4, 18}, BlockColor::CYAN);
+            setCell({6, 18}, BlockColor::CYAN);
+            setCell({8, 18}, BlockColor::CYAN);
 
             // Row 17 - yellow horizontal line
-            colorGrid.push_back({{2, 17}, BlockColor:: YELLOW});
-            colorGrid.push_back({{3, 17}, BlockColor:: YELLOW});
-            colorGrid.push_back({{4, 17}, BlockColor::YELLOW});
-            colorGrid.push_back({{5, 17}, BlockColor:: YELLOW});
-            colorGrid.push_back({{6, 17}, BlockColor::YELLOW});
-            colorGrid.push_back({{7, 17}, BlockColor:: YELLOW});
+            setCell({2, 17}, BlockColor:: YELLOW);
+            setCell({3, 17}, BlockColor:: YELLOW);
+            setCell({4, 17}, BlockColor::YELLOW);
+            setCell({5, 17}, BlockColor:: YELLOW);
+            setCell({6, 17}, BlockColor::YELLOW);
+            setCell({7, 17}, BlockColor:: YELLOW);
 
             // Row 16 - red L-shape
-            colorGrid.push_back({{3, 16}, BlockColor::RED});
-            colorGrid.push_back({{4, 16}, BlockColor::RED});
-            colorGrid.push_back({{5, 16}, BlockColor::RED});
+            setCell({3, 16}, BlockColor::RED);
+            setCell({4, 16}, BlockColor::RED);
+            setCell({5, 16}, BlockColor::RED);
 
             // Row 15 - green blocks
-            colorGrid.push_back({{1, 15}, BlockColor::GREEN});
-            colorGrid.push_back({{2, 15}, BlockColor::GREEN});
-            colorGrid.push_back({{7, 15}, BlockColor::GREEN});
-            colorGrid.push_back({{8, 15}, BlockColor::GREEN});
+            setCell({1, 15}, BlockColor::GREEN);
+            setCell({2, 15}, BlockColor::GREEN);
+            setCell({7, 15}, BlockColor::GREEN);
+            setCell({8, 15}, BlockColor::GREEN);
 
             // Row 14 - blue blocks
-            colorGrid.push_back({{7, 14}, BlockColor:: BLUE});
-            colorGrid.push_back({{8, 14}, BlockColor::BLUE});
-            colorGrid.push_back({{9, 14}, BlockColor::BLUE});
+            setCell({7, 14}, BlockColor:: BLUE);
+            setCell({8, 14}, BlockColor::BLUE);
+            setCell({9, 14}, BlockColor::BLUE);
 
             // Row 13 - purple T-shape
-            colorGrid.push_back({{4, 13}, BlockColor:: PURPLE});
-            colorGrid.push_back({{5, 13}, BlockColor::PURPLE});
-            colorGrid.push_back({{6, 13}, BlockColor::PURPLE});
+            setCell({4, 13}, BlockColor:: PURPLE);
+            setCell({5, 13}, BlockColor::PURPLE);
+            setCell({6, 13}, BlockColor::PURPLE);
 
             // Row 10 - floating orange blocks
-            colorGrid.push_back({{2, 10}, BlockColor:: ORANGE});
-            colorGrid.push_back({{3, 10}, BlockColor::ORANGE});
+            setCell({2, 10}, BlockColor:: ORANGE);
+            setCell({3, 10}, BlockColor::ORANGE);
 
             // Row 8 - scattered blocks
-            colorGrid.push_back({{5, 8}, BlockColor:: CYAN});
-            colorGrid.push_back({{6, 8}, BlockColor::CYAN});
+            setCell({5, 8}, BlockColor:: CYAN);
+            setCell({6, 8}, BlockColor::CYAN);
 
             // Row 5 - single blocks
-            colorGrid.push_back({{1, 5}, BlockColor::RED});
-            colorGrid.push_back({{8, 5}, BlockColor:: BLUE});
+            setCell({1, 5}, BlockColor::RED);
+            setCell({8, 5}, BlockColor:: BLUE);
 
         }
 
-        bool isValidPosition(Point position) {
+        [[nodiscard]] bool isValidPosition(const Point position) const {
             // first check if in bounds
-            if (position.y < 0 || position.y >= grid.size()) {
+            if (!isInBounds(position)) {
+                return false;
+            }
+
+            // then check if touching another block
+            return !hasBlockAt(position.x, position.y);
+        }
+
+        // Row dy of the piece's box as a grid row mask, with the box's left edge at column x
+        static constexpr RowMask pieceRow(const PieceShape& shape, const int dy, const int x) {
+            const int shift = x + WALL_BITS;
+            const RowMask row = shape.rowMasks[dy];
+            return static_cast<RowMask>(shift >= 0 ? row << shift : row >> -shift);
+        }
+
+        // True if the piece fits with its box at position, one AND per row of the piece
+        [[nodiscard]] bool fits(const PieceShape& shape, const Point position) const {
+            // anything past the wall bits can't be shifted into a row mask
+            if (position.x + shape.minX < -WALL_BITS || position.x + shape.maxX >= WIDTH + WALL_BITS) {
                 return false;
             }
 
-            if (position.x < 0 || position.x >= grid[0].size()) {
+            if (position.y + shape.minY < 0 || position.y + shape.maxY >= HEIGHT) {
                 return false;
             }
 
-            // then check if touching another block
-            for (const auto colorPosition : colorGrid) {
-                if (position.x == colorPosition.position.x && position.y == colorPosition.position.y) {
+            for (int dy = shape.minY; dy <= shape.maxY; dy++) {
+                if ((rows[position.y + dy] & pieceRow(shape, dy, position.x)) != 0) {
                     return false;
                 }
             }
 
             return true;
+        }
 
+        // How tall column x stands, 0 if it is empty. Its top cell is the lowest set bit of the
+        // column mask, and an empty column only has the floor bit at HEIGHT.
+        [[nodiscard]] int columnHeight(const int x) const {
+            return HEIGHT - std::countr_zero(columns[x]);
         }
 
-        void addColorBlocks(BlockData block) {
+        // How many rows the piece can fall from position before it lands, 0 if it is already resting.
+        // Each cell looks up the first filled cell below it in its column, so this costs the same
+        // no matter how far the drop is. Assumes the piece fits at position.
+        [[nodiscard]] int dropDistance(const PieceShape& shape, const Point position) const {
+            int distance = HEIGHT;
 
+            for (const auto& cell : shape.cells) {
+                const int x = position.x + cell.x;
+                const int y = position.y + cell.y;
+
+                // empty cells between this one and the next filled one (or the floor)
+                const int gap = std::countr_zero(static_cast<ColumnMask>(columns[x] >> (y + 1)));
+                if (gap < distance) {
+                    distance = gap;
+                }
+            }
+
+            return distance;
+        }
+
+        // Locks the cells into the grid and returns the number of rows it cleared
+        int addColorBlocks(const BlockData& block) {
             for (const auto position: block.positions) {
-                colorGrid.push_back({position, block.color});
+                setCell(position, block.color);
             }
 
-            deleteFilledRows();
+            // Only rows the block landed in can have become full
+            int lowestFilledRow = -1;
+            for (const auto position : block.positions) {
+                if (isInBounds(position) && position.y > lowestFilledRow && isRowFilled(position.y)) {
+                    lowestFilledRow = position.y;
+                }
+            }
+
+            lastRowsCleared = lowestFilledRow < 0 ? 0 : compactFilledRows(lowestFilledRow);
+
+            return lastRowsCleared;
+        }
 
+        // Zobrist hash of the locked cells, equal boards hash equal
+        [[nodiscard]] std::uint64_t getHash() const {
+            return hash;
+        }
+
+        // Everything unplace() needs to take back a place()
+        struct PlaceRecord {
+            const PieceShape* shape;
+            Point position;
+            // the rows under the piece's box as they were before it landed, by box row
+            std::array<RowMask, 4> previousRows;
+            // bit y set for each row the placement cleared, their colors top to bottom
+            std::uint64_t clearedRows;
+            std::array<std::array<BlockColor, WIDTH>, 4> clearedColors;
+            // XOR it back in to get the old hash
+            std::uint64_t hashDelta;
+            int previousRowsCleared;
+        };
+
+        // Locks the piece with its box at position (it has to fit) and clears full rows,
+        // like addColorBlocks(), but returns what it changed so unplace() can take it back
+        PlaceRecord place(const PieceShape& shape, const Point position, const BlockColor color) {
+            PlaceRecord record{&shape, position, {}, 0, {}, hash, lastRowsCleared};
+
+            for (int dy = shape.minY; dy <= shape.maxY; dy++) {
+                record.previousRows[dy] = rows[position.y + dy];
+            }
+
+            for (const auto& cell : shape.cells) {
+                setCell({position.x + cell.x, position.y + cell.y}, color);
+            }
+
+            // rows go top to bottom, so the colors land in the order reinsertClearedRows() wants
+            int lowestFilledRow = -1;
+            int cleared = 0;
+            for (int dy = shape.minY; dy <= shape.maxY; dy++) {
+                const int y = position.y + dy;
+                if (isRowFilled(y)) {
+                    record.clearedRows |= std::uint64_t{1} << y;
+                    record.clearedColors[cleared++] = colors[y];
+                    lowestFilledRow = y;
+                }
+            }
+
+            lastRowsCleared = lowestFilledRow < 0 ? 0 : compactFilledRows(lowestFilledRow);
+            record.hashDelta ^= hash;
+
+            return record;
+        }
+
+        // Takes back the last place() that hasn't been taken back yet, leaving the grid exactly
+        // as it was before it. Records have to be undone newest first.
+        void unplace(const PlaceRecord& record) {
+            const PieceShape& shape = *record.shape;
+            const Point position = record.position;
+
+            if (record.clearedRows != 0) {
+                reinsertClearedRows(record.clearedRows, record.clearedColors);
+            }
+
+            for (int dy = shape.minY; dy <= shape.maxY; dy++) {
+                rows[position.y + dy] = record.previousRows[dy];
+            }
+
+            for (const auto& cell : shape.cells) {
+                colors[position.y + cell.y][position.x + cell.x] = BlockColor::NONE;
+            }
+
+            if (record.clearedRows != 0) {
+                rebuildColumns();
+            } else {
+                for (const auto& cell : shape.cells) {
+                    columns[position.x + cell.x] &= static_cast<ColumnMask>(~(ColumnMask{1} << (position.y + cell.y)));
+                }
+            }
+
+            hash ^= record.hashDelta;
+            lastRowsCleared = record.previousRowsCleared;
+        }
+
+        // Rows cleared by the last addColorBlocks(), for callers that lock through a Block
+        [[nodiscard]] int getLastRowsCleared() const {
+            return lastRowsCleared;
         }
 
 
@@ -202,5 +534,8 @@ class GameGrid {
 
 };
 
+// The standard board: 10 columns, 20 visible rows and 4 hidden ones on top to spawn in
+using GameGrid = BasicGameGrid<10, 24>;
+
 
 #endif //SIMPLETETRIS_GAMEGRID_H
\ No newline at end of file
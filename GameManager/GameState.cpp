@@ -0,0 +1,8 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#include "GameState.h"
+
+// Compile the standard board's rules into tetris_core once
+template class BasicGameState<GameGrid>;
@@ -0,0 +1,228 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_GAMESTATE_H
+#define SIMPLETETRIS_GAMESTATE_H
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "enums.h"
+#include "GameGrid.h"
+#include "GravityScheduler.h"
+#include "Randomizer.h"
+#include "Blocks/Block.h"
+
+// Counters a finished (or running) game reports
+struct GameStats {
+    std::uint64_t frames = 0;
+    std::uint64_t piecesPlaced = 0;
+    std::uint64_t linesCleared = 0;
+
+    // clearsByLines[n] = how many locks cleared exactly n rows
+    std::array<std::uint64_t, 5> clearsByLines{};
+};
+
+// The rules of one game without any terminal, threads or clock reads: a grid, the falling
+// block and gravity. Time only moves when the caller says so, either in fixed frames
+// through step() or to timestamps the caller read itself through setTime().
+// Use GameState for the standard board.
+template <typename Grid>
+class BasicGameState {
+public:
+    using ActiveBlock = BasicBlock<Grid>;
+
+    // top-left of a new piece's box, middle columns just above the visible rows
+    static constexpr int HIDDEN_ROWS = Grid::HEIGHT > 20 ? Grid::HEIGHT - 20 : 0;
+    static constexpr Point SPAWN_POSITION{(Grid::WIDTH - 4) / 2, HIDDEN_ROWS >= 2 ? HIDDEN_ROWS - 2 : 0};
+
+private:
+    Grid grid;
+
+    std::optional<ActiveBlock> activeBlock;
+
+    // Deals the pieces, seeded per game so equal seeds give equal games
+    BagRandomizer randomizer;
+
+    // Configurable drop speed and lock delay
+    GravityScheduler gravity;
+
+    // current simulation time, new blocks start their gravity from here
+    GravityScheduler::TimePoint simulationTime{};
+
+    bool gameOver = false;
+
+    GameStats stats;
+
+    // Returns true if spawn was successful, false if game over
+    bool spawnNewBlock() {
+        BlockType randomType = randomizer.next();
+
+        // Create the new block
+        ActiveBlock newBlock(SPAWN_POSITION, randomType, pieceColor(randomType), &grid);
+
+        // Check if the spawn position is valid
+        if (!grid.fits(pieceShape(randomType, 0), SPAWN_POSITION)) {
+            // Game over - can't spawn new block
+            return false;
+        }
+
+        // Valid spawn - replace the active block
+        activeBlock = newBlock;
+        gravity.reset(simulationTime);  // Reset drop timer
+
+        return true;
+    }
+
+    // Books the lock that just happened and spawns the next block, ends the game if there is no room
+    void onLocked() {
+        const int rowsCleared = grid.getLastRowsCleared();
+
+        stats.piecesPlaced++;
+        stats.linesCleared += rowsCleared;
+        stats.clearsByLines[rowsCleared]++;
+
+        if (!spawnNewBlock()) {
+            gameOver = true;
+        }
+    }
+
+public:
+    BasicGameState() = default;
+
+    // The grid is owned here and blocks point into it, so the state stays where it was made
+    BasicGameState(const BasicGameState&) = delete;
+    BasicGameState& operator=(const BasicGameState&) = delete;
+
+    // Clears everything, deals from a fresh bag for seed and spawns the first block at startTime
+    void start(const std::uint64_t seed, const GravityScheduler::TimePoint startTime = {}) {
+        randomizer.reset(seed);
+        grid.clear();
+        activeBlock.reset();
+        stats = {};
+        simulationTime = startTime;
+        gameOver = !spawnNewBlock();
+    }
+
+    // Cells per frame (1/60 s), 1.0 / 60 is a cell per second and 20 is instant
+    void setGravity(const double cellsPerFrame) {
+        gravity.setGravity(cellsPerFrame);
+    }
+
+    void setLockDelay(const GravityScheduler::Duration lockDelay) {
+        gravity.setLockDelay(lockDelay);
+    }
+
+    // How many upcoming pieces getPreview() shows, up to BagRandomizer::MAX_PREVIEW
+    void setPreviewCount(const int count) {
+        randomizer.setPreviewCount(count);
+    }
+
+    // Moves simulation time to now, for callers running on a real clock
+    void setTime(const GravityScheduler::TimePoint now) {
+        simulationTime = now;
+    }
+
+    // Applies one player move to the active block, spawning the next one if it locked.
+    // Returns true if anything changed.
+    bool applyMove(const BlockMove move) {
+        // nothing moves anymore once the game is over
+        if (!activeBlock.has_value() || gameOver) {
+            return false;
+        }
+
+        MoveResult result = activeBlock->moveBlock(move);
+
+        if (result == MoveResult::LOCKED) {
+            onLocked();
+        } else if (result == MoveResult::MOVED) {
+            gravity.onPlayerMove(simulationTime);
+        }
+
+        return result != MoveResult::BLOCKED;
+    }
+
+    // Lets the block fall by however many cells are due and locks it once the lock delay ran out.
+    // Returns true if anything changed.
+    bool applyGravity() {
+        if (!activeBlock.has_value() || gameOver) {
+            return false;
+        }
+
+        bool changed = false;
+
+        for (int cells = gravity.takeDueCells(simulationTime); cells > 0 && activeBlock->canMoveDown(); cells--) {
+            activeBlock->moveBlock(BlockMove::DOWN);
+            changed = true;
+        }
+
+        if (activeBlock->canMoveDown()) {
+            gravity.onAirborne();
+            return changed;
+        }
+
+        gravity.onGrounded(simulationTime, activeBlock->bottomRow());
+
+        if (gravity.isLockDue(simulationTime)) {
+            activeBlock->lock();
+            onLocked();
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    // Advances exactly one frame: the moves in order, then gravity.
+    // The same moves on the same frames always give the same game.
+    bool step(const std::span<const BlockMove> moves = {}) {
+        simulationTime += GravityScheduler::FRAME;
+        stats.frames++;
+
+        bool changed = false;
+
+        for (const BlockMove move : moves) {
+            changed |= applyMove(move);
+        }
+
+        changed |= applyGravity();
+
+        return changed;
+    }
+
+    // When gravity or the lock delay needs the next applyGravity()
+    [[nodiscard]] GravityScheduler::TimePoint nextDeadline() const {
+        return gravity.nextDeadline();
+    }
+
+    [[nodiscard]] const Grid& getGrid() const {
+        return grid;
+    }
+
+    [[nodiscard]] const std::optional<ActiveBlock>& getActiveBlock() const {
+        return activeBlock;
+    }
+
+    [[nodiscard]] int getPreviewCount() const {
+        return randomizer.getPreviewCount();
+    }
+
+    // The piece that spawns index + 1 pieces from now
+    [[nodiscard]] BlockType getPreview(const int index) const {
+        return randomizer.peek(index);
+    }
+
+    [[nodiscard]] bool isGameOver() const {
+        return gameOver;
+    }
+
+    [[nodiscard]] const GameStats& getStats() const {
+        return stats;
+    }
+};
+
+using GameState = BasicGameState<GameGrid>;
+
+
+#endif //SIMPLETETRIS_GAMESTATE_H
@@ -0,0 +1,135 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_GRAVITYSCHEDULER_H
+#define SIMPLETETRIS_GRAVITYSCHEDULER_H
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+// Decides when the active block falls and when it locks, from absolute timestamps.
+// Gravity is given in cells per frame (1/60 s) like in the guideline games, so
+// 1.0 / 60 is one cell per second, 1 is 1G and 20 drops the block to the floor at once.
+// Everything is measured from the moment the block spawned, so late wakeups never add up to drift.
+class GravityScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = std::chrono::nanoseconds;
+
+    static constexpr Duration FRAME = std::chrono::nanoseconds(1000000000 / 60);
+
+    // After this many lock resets the block locks on the next deadline no matter what
+    static constexpr int MAX_LOCK_RESETS = 15;
+
+private:
+    double cellsPerFrame = 1.0 / 18;  // one cell every 300 ms
+    Duration lockDelay = std::chrono::milliseconds(500);
+
+    // when the current block spawned, gravity counts from here
+    TimePoint epoch{};
+    std::int64_t cellsTaken = 0;
+
+    bool grounded = false;
+    TimePoint groundedSince{};
+    int lockResets = 0;
+    // the lowest row the block has been grounded on, landing any lower earns the resets back
+    int lowestRow = std::numeric_limits<int>::min();
+
+    [[nodiscard]] std::int64_t cellsElapsed(const TimePoint now) const {
+        if (cellsPerFrame <= 0 || now <= epoch) {
+            return 0;
+        }
+
+        const double frames = static_cast<double>((now - epoch).count()) / static_cast<double>(FRAME.count());
+        return static_cast<std::int64_t>(frames * cellsPerFrame);
+    }
+
+public:
+
+    void setGravity(const double newCellsPerFrame) {
+        cellsPerFrame = newCellsPerFrame;
+    }
+
+    void setLockDelay(const Duration newLockDelay) {
+        lockDelay = newLockDelay;
+    }
+
+    // A new block spawned at now
+    void reset(const TimePoint now) {
+        epoch = now;
+        cellsTaken = 0;
+        grounded = false;
+        lockResets = 0;
+        lowestRow = std::numeric_limits<int>::min();
+    }
+
+    // How many cells the block should have fallen since the last call. Can be more
+    // than one when gravity is faster than the caller wakes up.
+    int takeDueCells(const TimePoint now) {
+        const std::int64_t total = cellsElapsed(now);
+        const std::int64_t due = total - cellsTaken;
+        cellsTaken = total;
+
+        return due > 0 ? static_cast<int>(due) : 0;
+    }
+
+    // The block can't fall any further with its lowest cell on row, the lock delay starts if it isn't running already.
+    // Landing again on the same row or higher (after a kick lifted it) uses up a lock reset,
+    // once they're gone it keeps the old deadline, so kicking up and down can't stall forever.
+    void onGrounded(const TimePoint now, const int row) {
+        if (grounded) {
+            return;
+        }
+
+        grounded = true;
+
+        if (row > lowestRow) {
+            lowestRow = row;
+            lockResets = 0;
+            groundedSince = now;
+        } else if (lockResets < MAX_LOCK_RESETS) {
+            lockResets++;
+            groundedSince = now;
+        }
+    }
+
+    // The block has room below it again (slid off an edge)
+    void onAirborne() {
+        grounded = false;
+    }
+
+    // The player moved or rotated the block, which restarts the lock delay a limited number of times
+    void onPlayerMove(const TimePoint now) {
+        if (grounded && lockResets < MAX_LOCK_RESETS) {
+            groundedSince = now;
+            lockResets++;
+        }
+    }
+
+    [[nodiscard]] bool isLockDue(const TimePoint now) const {
+        return grounded && now >= groundedSince + lockDelay;
+    }
+
+    // The next moment something is due, either the next gravity cell or the lock
+    [[nodiscard]] TimePoint nextDeadline() const {
+        if (grounded) {
+            return groundedSince + lockDelay;
+        }
+
+        if (cellsPerFrame <= 0) {
+            return TimePoint::max();
+        }
+
+        // first instant at which cellsElapsed() reaches cellsTaken + 1
+        const double frames = static_cast<double>(cellsTaken + 1) / cellsPerFrame;
+        // (one extra nanosecond so rounding can't wake us just before the cell is due)
+        const auto offset = static_cast<Duration::rep>(std::ceil(frames * static_cast<double>(FRAME.count()))) + 1;
+        return epoch + Duration(offset);
+    }
+};
+
+
+#endif //SIMPLETETRIS_GRAVITYSCHEDULER_H
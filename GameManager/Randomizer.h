@@ -0,0 +1,149 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_RANDOMIZER_H
+#define SIMPLETETRIS_RANDOMIZER_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "enums.h"
+#include "Blocks/PieceTables.h"
+
+// xoshiro256** by Blackman and Vigna. Small, fast and fully determined by its seed,
+// so every game carries its own generator instead of sharing rand()'s hidden state.
+class Xoshiro256 {
+
+    std::array<std::uint64_t, 4> state{};
+
+    static constexpr std::uint64_t rotl(const std::uint64_t x, const int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    explicit Xoshiro256(const std::uint64_t seed = 0) {
+        reseed(seed);
+    }
+
+    // Spreads one 64 bit seed over the whole state with splitmix64, as the authors recommend
+    void reseed(std::uint64_t seed) {
+        for (auto& word : state) {
+            seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    std::uint64_t next() {
+        const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    // Uniform in [0, bound) without modulo bias (Lemire's multiply and reject)
+    std::uint32_t nextBelow(const std::uint32_t bound) {
+        std::uint64_t product = (next() >> 32) * bound;
+        auto low = static_cast<std::uint32_t>(product);
+
+        if (low < bound) {
+            const std::uint32_t threshold = -bound % bound;
+            while (low < threshold) {
+                product = (next() >> 32) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+};
+
+// The guideline 7-bag: every run of 7 pieces is one of each type in shuffled order,
+// with the next few pieces visible ahead of time.
+class BagRandomizer {
+public:
+    static constexpr int MAX_PREVIEW = 6;
+
+private:
+    // upcoming pieces, always holds at least previewCount + 1 of them
+    static constexpr std::size_t QUEUE_CAPACITY = 16;
+    static_assert(QUEUE_CAPACITY >= MAX_PREVIEW + 1 + PIECE_TYPE_COUNT);
+
+    Xoshiro256 rng;
+
+    std::array<BlockType, QUEUE_CAPACITY> queue{};
+    std::size_t head = 0;
+    std::size_t size = 0;
+
+    int previewCount = 5;
+
+    void refill() {
+        while (size < static_cast<std::size_t>(previewCount) + 1) {
+            std::array<BlockType, PIECE_TYPE_COUNT> bag{};
+            for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+                bag[type] = static_cast<BlockType>(type);
+            }
+
+            // Fisher-Yates
+            for (int i = PIECE_TYPE_COUNT - 1; i > 0; i--) {
+                const auto j = static_cast<int>(rng.nextBelow(static_cast<std::uint32_t>(i + 1)));
+                std::swap(bag[i], bag[j]);
+            }
+
+            for (const BlockType type : bag) {
+                queue[(head + size) % QUEUE_CAPACITY] = type;
+                size++;
+            }
+        }
+    }
+
+public:
+    explicit BagRandomizer(const std::uint64_t seed = 0) {
+        reset(seed);
+    }
+
+    // Starts over, the same seed always deals the same pieces
+    void reset(const std::uint64_t seed) {
+        rng.reseed(seed);
+        head = 0;
+        size = 0;
+        refill();
+    }
+
+    // How many upcoming pieces peek() can show, at most MAX_PREVIEW
+    void setPreviewCount(const int count) {
+        previewCount = count < 0 ? 0 : (count > MAX_PREVIEW ? MAX_PREVIEW : count);
+        refill();
+    }
+
+    [[nodiscard]] int getPreviewCount() const {
+        return previewCount;
+    }
+
+    BlockType next() {
+        const BlockType type = queue[head];
+        head = (head + 1) % QUEUE_CAPACITY;
+        size--;
+        refill();
+        return type;
+    }
+
+    // The piece that comes index + 1 pieces from now, index < getPreviewCount()
+    [[nodiscard]] BlockType peek(const int index) const {
+        return queue[(head + static_cast<std::size_t>(index)) % QUEUE_CAPACITY];
+    }
+};
+
+
+#endif //SIMPLETETRIS_RANDOMIZER_H
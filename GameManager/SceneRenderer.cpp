@@ -3,3 +3,6 @@
 //
 
 #include "SceneRenderer.h"
+
+// Compile the standard board's front end here once
+template class BasicSceneRenderer<GameGrid>;
@@ -1,68 +1,150 @@
 #ifndef SIMPLETETRIS_SCENERENDERER_H
 #define SIMPLETETRIS_SCENERENDERER_H
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <vector>
 #include <curses.h>  // PDCurses or ncurses
 #include <iostream>
 #include <mutex>
+#include <optional>
+#include <random>
 
+#include "FrameSignal.h"
+#include "FrameSnapshot.h"
 #include "GameGrid.h"
+#include "GameState.h"
+#include "GravityScheduler.h"
+#include "SpscQueue.h"
+#include "TerminalInput.h"
+#include "TripleBuffer.h"
 #include "Blocks/Block.h"
+#include "Diagnostics/AllocationCounter.h"
 
-class SceneRenderer {
+// How startGame() runs the game
+enum class GameLoopMode {
+    THREADED,        // separate update, render and input threads
+    SINGLE_THREADED  // one fixed timestep loop doing all three, deterministic stepping
+};
+
+// The terminal front end, runs one game on a Grid (any BasicGameGrid).
+// Use SceneRenderer for the standard board.
+template <typename Grid>
+class BasicSceneRenderer {
+
+    using State = BasicGameState<Grid>;
+    using Snapshot = BasicFrameSnapshot<Grid>;
 
     std::atomic<bool> gameRunning{false};
 
     std::mutex nCursesMutex;
 
-    std::mutex blockMutex;
-
     int updateCounter = 0;
     int renderCounter = 0;
 
-    // Configurable drop speed (milliseconds between auto-drops)
-    int dropInterval = 300;  // 1 second by default
-    int dropTimer = 0;
+    // heap allocations made by the render thread during its last frame
+    std::size_t lastFrameAllocations = 0;
 
-    GameGrid grid;
+    // What is currently on the terminal, so a frame only redraws cells that changed
+    // (color, plus GHOST_CELL for the landing preview)
+    using ScreenCell = std::uint8_t;
+    static constexpr ScreenCell GHOST_CELL = 0x80;
 
-    std::optional<Block> activeBlock;
+    std::array<std::array<ScreenCell, Grid::WIDTH>, Grid::HEIGHT> screenCells{};
+    bool screenDrawn = false;
+    int lastFrameCellsDrawn = 0;
 
-    // Returns true if spawn was successful, false if game over
-    bool spawnNewBlock() {
-        BlockType types[] = {BlockType::I, BlockType::O, BlockType::T,
-                            BlockType::Z, BlockType::J, BlockType::L};
-        BlockType randomType = types[rand() % 6];
+    // first row that is shown, the ones above are the spawn area
+    static constexpr int rowsToSkip = State::HIDDEN_ROWS;
 
-        BlockColor colors[] = {BlockColor:: CYAN, BlockColor:: YELLOW,
-                              BlockColor:: PURPLE, BlockColor::GREEN,
-                              BlockColor::RED, BlockColor::BLUE, BlockColor::ORANGE};
-        BlockColor randomColor = colors[rand() % 7];
+    // The preview column right of the board, redrawn only when the queue moves
+    static constexpr int previewColumn = Grid::WIDTH * 2 + 2;
+    static constexpr int previewSlotRows = 3;
+    std::array<BlockType, BagRandomizer::MAX_PREVIEW> screenPreview{};
+    int screenPreviewCount = -1;
 
-        Point spawnPos = {5, 2};
+    // seeds the piece bag, a fresh one per run unless setSeed() picks one
+    std::uint64_t seed = std::random_device{}();
 
-        // Create the new block
-        Block newBlock(spawnPos, randomType, randomColor, &grid);
+    // The game itself: grid, active block and gravity
+    State state;
 
-        // Check if the spawn position is valid
-        auto spawnPositions = newBlock.getCurrentPosition();
-        for (const auto& pos : spawnPositions) {
-            if (! grid.isValidPosition(pos)) {
-                // Game over - can't spawn new block
-                return false;
-            }
+    // Moves from the input thread to the update thread, which is the only one
+    // allowed to touch state. Applied strictly in order, so the
+    // same command stream always plays out the same way.
+    SpscQueue<BlockMove, 64> moveCommands;
+
+#ifndef _WIN32
+    // blocking key reader for the input thread, bypasses curses entirely
+    TerminalInput terminalInput;
+#endif
+
+    // Board + piece snapshots going from the update thread to the render thread
+    TripleBuffer<Snapshot> frames;
+
+    std::uint64_t publishedFrames = 0;
+
+    // wakes the render thread whenever a new snapshot is published
+    FrameSignal frameSignal;
+
+    // Upper bound on redraws per second, changes faster than this get merged into one frame
+    int maxFrameRate = 60;
+
+    // wakes the update thread when the input thread queued a move
+    FrameSignal inputSignal;
+
+    // Copies the current grid and active block into a snapshot and hands it to the renderer.
+    // Only called from the update thread (or before it starts).
+    void publishFrame() {
+        Snapshot& frame = frames.writeBuffer();
+
+        const auto colors = state.getGrid().getColors();
+        std::copy(colors.begin(), colors.end(), frame.colors.begin());
+
+        const auto& activeBlock = state.getActiveBlock();
+
+        frame.hasActiveBlock = activeBlock.has_value();
+        if (activeBlock.has_value()) {
+            frame.activePositions = activeBlock->getCurrentPosition();
+            frame.ghostPositions = activeBlock->getGhostPosition();
+            frame.activeColor = activeBlock->getColor();
         }
 
-        // Valid spawn - replace the active block
-        activeBlock = newBlock;
-        dropTimer = 0;  // Reset drop timer
+        frame.previewCount = state.getPreviewCount();
+        for (int i = 0; i < frame.previewCount; i++) {
+            frame.preview[i] = state.getPreview(i);
+        }
 
-        return true;
+        frame.sequence = ++publishedFrames;
+        frames.publish();
+        frameSignal.notify();
     }
 
 public:
-    SceneRenderer() = default;
+    BasicSceneRenderer() = default;
+
+    void setMaxFrameRate(const int framesPerSecond) {
+        maxFrameRate = framesPerSecond > 0 ? framesPerSecond : 1;
+    }
+
+    // Cells per frame (1/60 s), 1.0 / 60 is a cell per second and 20 is instant
+    void setGravity(const double cellsPerFrame) {
+        state.setGravity(cellsPerFrame);
+    }
+
+    void setLockDelay(const GravityScheduler::Duration lockDelay) {
+        state.setLockDelay(lockDelay);
+    }
+
+    // Same seed, same pieces
+    void setSeed(const std::uint64_t newSeed) {
+        seed = newSeed;
+    }
+
+    void setPreviewCount(const int count) {
+        state.setPreviewCount(count);
+    }
 
     // Initialize curses; call before startGame or in startGame
     void initCurses() {
@@ -107,33 +189,79 @@ public:
         endwin();             // Restore terminal
     }
 
-    void startGame() {
+    void startGame(const GameLoopMode mode = GameLoopMode::THREADED) {
         initCurses();
         gameRunning.store(true);
 
-        // grid.createDummyData();
+        state.start(seed, GravityScheduler::Clock::now());
+        publishFrame();
 
-        // Use emplace to construct the Block in-place
-        activeBlock.emplace(Point{5, 5}, BlockType::Z, BlockColor::BLUE, &grid);
+        if (mode == GameLoopMode::SINGLE_THREADED) {
+            singleThreadLoop();
+        } else {
+            std::thread updateThread(&BasicSceneRenderer::updateThreadTest, this);
+            std::thread renderThread(&BasicSceneRenderer::renderThreadTest, this);
+            std::thread inputThread(&BasicSceneRenderer::inputThread, this);
 
-        std::thread updateThread(&SceneRenderer::updateThreadTest, this);
-        std::thread renderThread(&SceneRenderer::renderThreadTest, this);
-        std::thread inputThread(&SceneRenderer::inputThread, this);
 
-
-        updateThread.join();
-        renderThread.join();
-        inputThread.join();
+            updateThread.join();
+            renderThread.join();
+            inputThread.join();
+        }
 
         shutdownCurses();
     }
 
     void endGame() {
         gameRunning.store(false);
+
+        // let the render and update threads out of their waits
+        frameSignal.stop();
+        inputSignal.stop();
+
+#ifndef _WIN32
+        // the input thread may be blocked waiting for a key
+        terminalInput.interrupt();
+#endif
+    }
+
+    // Turns a key into a move for the update thread
+    void handleKey(const int ch) {
+        if (ch == 'q' || ch == 'Q') {
+            endGame();
+        }
+
+        // Hand the key over as a move, the update thread applies it
+        bool queued = false;
+
+        if (ch == KEY_LEFT) {
+            queued = moveCommands.push(BlockMove::LEFT);
+        }
+        else if (ch == KEY_RIGHT) {
+            queued = moveCommands.push(BlockMove::RIGHT);
+        }
+        else if (ch == KEY_DOWN) {
+            // Move down faster
+            queued = moveCommands.push(BlockMove::DOWN);
+        }
+        else if (ch == KEY_UP || ch == ' ') {
+            // Rotate
+            queued = moveCommands.push(BlockMove::ROTATE);
+        }
+        else if (ch == 'z' || ch == 'Z') {
+            // Rotate the other way
+            queued = moveCommands.push(BlockMove::ROTATE_CCW);
+        }
+
+        if (queued) {
+            inputSignal.notify();
+        }
     }
 
     void inputThread() {
 
+#ifdef _WIN32
+        // PDCurses has no terminal fd to wait on, so poll getch there
         while (gameRunning. load()) {
             int ch;
             {
@@ -142,183 +270,325 @@ public:
             }
 
             if (ch != ERR) {
+                handleKey(ch);
+            }
 
-                if (ch == 'q' || ch == 'Q') {
-                    endGame();
-                }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+#else
+        // Sleep in poll() until keys arrive and handle all of them per wakeup
+        while (gameRunning.load()) {
+            if (!terminalInput.waitForKeys([this](const int ch) { handleKey(ch); })) {
+                break;
+            }
+        }
+#endif
+    }
 
-                if (activeBlock.has_value()) {
-                    // Lock block access
-                    std::lock_guard<std::mutex> blockLock(blockMutex);
 
-                    MoveResult moveResult = MoveResult::BLOCKED;
+    // Applies one move and ends the game if it made the stack top out
+    bool applyMove(const BlockMove move) {
+        const bool changed = state.applyMove(move);
 
+        if (state.isGameOver()) {
+            endGame();
+        }
 
-                    // Handle other keys
-                    if (ch == KEY_LEFT) {
-                        moveResult = activeBlock.value().moveBlock(BlockMove::LEFT);
-                    }
-                    else if (ch == KEY_RIGHT) {
-                        // Move right
+        return changed;
+    }
 
-                        moveResult = activeBlock.value().moveBlock(BlockMove::RIGHT);
+    bool applyGravity() {
+        const bool changed = state.applyGravity();
 
-                    }
-                    else if (ch == KEY_DOWN) {
-                        // Move down faster
+        if (state.isGameOver()) {
+            endGame();
+        }
 
-                        moveResult = activeBlock.value().moveBlock(BlockMove::DOWN);
+        return changed;
+    }
 
-                    }
-                    else if (ch == KEY_UP || ch == ' ') {
-                        // Rotate
+    void updateThreadTest() {
+        // upper bound on how long the thread sleeps when nothing is scheduled
+        const auto maxSleep = std::chrono::seconds(1);
 
-                        moveResult = activeBlock.value().moveBlock(BlockMove::ROTATE);
+        std::uint64_t seenInput = 0;
 
-                    }
+        while (gameRunning.load()) {
+            updateCounter++;
+            const auto now = GravityScheduler::Clock::now();
+            state.setTime(now);
 
-                    if (moveResult == MoveResult::LOCKED) {
-                        auto spawnResult = spawnNewBlock();
+            bool changed = false;
 
-                        if (spawnResult == false) {
-                            gameRunning.store(false);
-                        }
-                    }
-                }
+            // Apply everything the input thread queued up since the last pass
+            while (auto move = moveCommands.pop()) {
+                changed |= applyMove(*move);
+            }
+
+            changed |= applyGravity();
 
+            if (changed) {
+                publishFrame();
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            // Sleep until the next drop or lock is due, or until a key comes in
+            const auto deadline = std::min(state.nextDeadline(), now + maxSleep);
+            seenInput = inputSignal.waitForChangeUntil(seenInput, deadline);
         }
     }
 
+    // Draws every cell whose color differs from what is on screen, returns how many it drew
+    int drawChangedCells(const Snapshot& frame) {
+        // Locked blocks with the ghost and then the active block laid over them
+        std::array<std::array<ScreenCell, Grid::WIDTH>, Grid::HEIGHT> cells{};
 
-    void updateThreadTest() {
-        const int updateIntervalMs = 100;  // Update every 100ms
+        for (int r = 0; r < Grid::HEIGHT; ++r) {
+            for (int c = 0; c < Grid::WIDTH; ++c) {
+                cells[r][c] = static_cast<ScreenCell>(frame.colors[r][c]);
+            }
+        }
 
-        while (gameRunning.load()) {
-            updateCounter++;
-            dropTimer += updateIntervalMs;
+        const auto overlay = [&cells](const std::array<Point, 4>& positions, const ScreenCell cell) {
+            for (const auto& pos : positions) {
+                if (pos.x >= 0 && pos.x < Grid::WIDTH && pos.y >= 0 && pos.y < Grid::HEIGHT) {
+                    cells[pos.y][pos.x] = cell;
+                }
+            }
+        };
 
-            // Auto-drop the block when timer reaches the interval
-            if (dropTimer >= dropInterval) {
-                std::lock_guard<std::mutex> blockLock(blockMutex);
+        if (frame.hasActiveBlock) {
+            overlay(frame.ghostPositions, static_cast<ScreenCell>(frame.activeColor) | GHOST_CELL);
+            overlay(frame.activePositions, static_cast<ScreenCell>(frame.activeColor));
+        }
 
-                if (activeBlock.has_value()) {
-                    MoveResult result = activeBlock->moveBlock(BlockMove::DOWN);
+        int cellsDrawn = 0;
 
-                    if (result == MoveResult::LOCKED) {
-                        bool spawnResult = spawnNewBlock();
-                        if (spawnResult == false) {
-                            gameRunning.store(false);
-                        }
-                    }
+        for (int r = rowsToSkip; r < Grid::HEIGHT; ++r) {
+            for (int c = 0; c < Grid::WIDTH; ++c) {
+                const ScreenCell cell = cells[r][c];
+
+                if (screenDrawn && screenCells[r][c] == cell) {
+                    continue;
                 }
 
-                dropTimer = 0;  // Reset the timer
-            }
+                const int colorPair = cell & ~GHOST_CELL;
+
+                // '.' for empty cells, colored '#' for blocks and colored ':' for the ghost,
+                // the color goes into the character itself
+                if (cell == static_cast<ScreenCell>(BlockColor::NONE)) {
+                    mvaddch(r, c * 2, '.');
+                } else if (cell & GHOST_CELL) {
+                    mvaddch(r, c * 2, ':' | COLOR_PAIR(colorPair));
+                } else {
+                    mvaddch(r, c * 2, '#' | COLOR_PAIR(colorPair));
+                }
+
+                // the spacer column never changes after the first frame
+                if (!screenDrawn) {
+                    mvaddch(r, c * 2 + 1, ' ');
+                }
 
-            std:: this_thread::sleep_for(std::chrono::milliseconds(updateIntervalMs));
+                screenCells[r][c] = cell;
+                cellsDrawn++;
+            }
         }
+
+        screenDrawn = true;
+        return cellsDrawn + drawPreview(frame);
     }
 
-    void renderThreadTest() {
+    // Draws the upcoming pieces in their spawn orientation if the queue moved, returns cells drawn
+    int drawPreview(const Snapshot& frame) {
+        if (frame.previewCount == screenPreviewCount &&
+            std::equal(frame.preview.begin(), frame.preview.begin() + frame.previewCount, screenPreview.begin())) {
+            return 0;
+        }
 
-        do {
-            {
+        int cellsDrawn = 0;
 
-                //skip first 4 rows
+        mvprintw(rowsToSkip, previewColumn, "Next");
 
-                int rowsToSkip = 4;
+        for (int i = 0; i < std::max(frame.previewCount, screenPreviewCount); i++) {
+            const int top = rowsToSkip + 1 + i * previewSlotRows;
 
-                std::lock_guard<std::mutex> lock(nCursesMutex);
-                // Clear the curses screen
-                auto currentGrid = grid.getGrid();
-                auto coloredBlocks = grid.getColorGrid();
+            // wipe the slot, pieces are at most 4 cells wide and 2 tall
+            for (int r = 0; r < previewSlotRows - 1; r++) {
+                mvprintw(top + r, previewColumn, "        ");
+            }
 
-                clear();
+            if (i >= frame.previewCount) {
+                continue;
+            }
 
-                // First pass: Draw the base grid (all '.' or '#')
-                for (int r = 0; r < static_cast<int>(currentGrid. size()); ++r) {
-                    if (r <= rowsToSkip - 1) continue;
+            const BlockType type = frame.preview[i];
+            const PieceShape& shape = pieceShape(type, 0);
+            const int colorPair = static_cast<int>(pieceColor(type));
 
-                    for (int c = 0; c < static_cast<int>(currentGrid[r].size()); ++c) {
-                        char cell = currentGrid[r][c];
-                        mvaddch(r, c * 2, cell);
-                        mvaddch(r, c * 2 + 1, ' ');
-                    }
-                }
+            for (const auto& cell : shape.cells) {
+                mvaddch(top + cell.y - shape.minY, previewColumn + cell.x * 2, '#' | COLOR_PAIR(colorPair));
+                cellsDrawn++;
+            }
 
-                // Second pass: Draw colored blocks on top
-                for (const auto& colorPos : coloredBlocks) {
-                    int x = colorPos.position.x;
-                    int y = colorPos.position.y;
-                    BlockColor color = colorPos.color;
-
-                    // Validate position
-                    if (x >= 0 && x < 10 && y >= rowsToSkip && y < currentGrid.size()) {
-                        if (color != BlockColor::NONE) {
-                            // Turn on the color
-                            attron(COLOR_PAIR(static_cast<int>(color)));
-
-                            // Draw the colored block
-                            mvaddch(y, x * 2, '#');
-                            mvaddch(y, x * 2 + 1, ' ');
-
-                            // Turn off the color
-                            attroff(COLOR_PAIR(static_cast<int>(color)));
-                        }
-                    }
-                }
+            screenPreview[i] = type;
+        }
 
-                // Third pass:  Draw active block (if it exists)
-                if (activeBlock.has_value()) {
-                    BlockColor blockColor = activeBlock->getColor();
-                    auto blockPositions = activeBlock->getCurrentPosition();
+        screenPreviewCount = frame.previewCount;
+        return cellsDrawn;
+    }
 
-                    attron(COLOR_PAIR(static_cast<int>(blockColor)));
+    // Draws the newest snapshot if there is one, returns how many cells changed
+    int renderFrame() {
+        std::lock_guard<std::mutex> lock(nCursesMutex);
 
-                    for (const auto& pos : blockPositions) {
-                        if (pos.x >= 0 && pos.x < 10 && pos.y >= rowsToSkip && pos.y < currentGrid.size()) {
-                            mvaddch(pos.y, pos.x * 2, '#');
-                            mvaddch(pos.y, pos.x * 2 + 1, ' ');
-                        }
-                    }
+        const std::size_t allocationsBefore = AllocationCounter::threadAllocations();
 
-                    attroff(COLOR_PAIR(static_cast<int>(blockColor)));
-                }
+        // An unchanged frame costs nothing
+        if (!frames.acquire() && screenDrawn) {
+            return 0;
+        }
 
+        const int cellsDrawn = drawChangedCells(frames.readBuffer());
 
+        if (cellsDrawn > 0) {
+            lastFrameCellsDrawn = cellsDrawn;
 
-                // Optional: draw a status line below the grid
-                mvprintw(static_cast<int>(currentGrid.size()) + 1, 0, "Press q to quit, %d", renderCounter);
+            // Optional: draw a status line below the grid
+            mvprintw(Grid::HEIGHT + 1, 0, "Press q to quit, cells/frame %3d, allocs/frame %zu",
+                     lastFrameCellsDrawn, lastFrameAllocations);
 
-                // Flush changes to the terminal
-                refresh();
+            // Flush changes to the terminal
+            refresh();
+        }
 
-            }
+        // should stay at 0 once curses has warmed up
+        lastFrameAllocations = AllocationCounter::threadAllocations() - allocationsBefore;
+
+        return cellsDrawn;
+    }
+
+    void renderThreadTest() {
+        const auto minFrameTime = std::chrono::microseconds(1000000 / maxFrameRate);
+
+        std::uint64_t seenChanges = 0;
 
+        while (gameRunning.load()) {
+            // Sleep until the simulation publishes something new
+            seenChanges = frameSignal.waitForChange(seenChanges);
+
+            const auto frameStart = std::chrono::steady_clock::now();
+
+            renderFrame();
             renderCounter++;
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            // Frame rate cap, whatever changes meanwhile gets drawn in the next frame
+            std::this_thread::sleep_until(frameStart + minFrameTime);
+        }
 
-        } while (gameRunning.load());
+        // the move that ended the game may not have been drawn yet
+        renderFrame();
 
+        showGameOver();
+    }
 
+    void showGameOver() {
         {
             std::lock_guard<std::mutex> blockLock(nCursesMutex);
 
-            auto currentGrid = grid.getGrid();
-            mvprintw(static_cast<int>(currentGrid.size()) + 3, 0, "GAME OVER");
+            mvprintw(Grid::HEIGHT + 3, 0, "GAME OVER");
 
             refresh();
         }
 
         // wait 10 seconds to show user has lost
         std::this_thread::sleep_for(std::chrono::milliseconds(10000));
+    }
+
+    // Runs input, simulation and rendering on the calling thread.
+    // The simulation advances in fixed steps of one frame, and moves only take effect on
+    // step boundaries, so the same keys on the same steps always give the same game.
+    void singleThreadLoop() {
+        using Clock = GravityScheduler::Clock;
+
+        const auto step = GravityScheduler::FRAME;
+        const auto minFrameTime = std::chrono::microseconds(1000000 / maxFrameRate);
+
+        // don't try to catch up on more than this after a stall (e.g. a suspended terminal)
+        const int maxStepsPerPass = 10;
+
+        auto previousTime = Clock::now();
+        auto lastRenderTime = previousTime - minFrameTime;
+        GravityScheduler::Duration accumulator{};
+
+        // everything typed since the last step goes into the next one
+        std::array<BlockMove, 64> moves{};
+
+        while (gameRunning.load()) {
+            // Wait for keys, but no longer than until the next step is due
+            // rounded up, a 0 ms timeout in the last fraction of a millisecond would just spin
+            const auto untilNextStep = std::chrono::ceil<std::chrono::milliseconds>(step - accumulator);
+            const int timeoutMs = untilNextStep.count() > 0 ? static_cast<int>(untilNextStep.count()) : 0;
+
+#ifdef _WIN32
+            int ch;
+            while ((ch = getch()) != ERR) {
+                handleKey(ch);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+#else
+            if (!terminalInput.waitForKeys([this](const int ch) { handleKey(ch); }, timeoutMs)) {
+                break;
+            }
+#endif
+
+            const auto now = Clock::now();
+            accumulator += now - previousTime;
+            previousTime = now;
 
+            if (accumulator > step * maxStepsPerPass) {
+                accumulator = step * maxStepsPerPass;
+            }
+
+            bool changed = false;
+
+            // Fixed steps, simulation time only ever moves by exactly one step
+            while (accumulator >= step && gameRunning.load()) {
+                accumulator -= step;
+                updateCounter++;
+
+                std::size_t moveCount = 0;
+                while (moveCount < moves.size()) {
+                    auto move = moveCommands.pop();
+                    if (!move) {
+                        break;
+                    }
+                    moves[moveCount++] = *move;
+                }
+
+                changed |= state.step(std::span<const BlockMove>(moves.data(), moveCount));
+
+                if (state.isGameOver()) {
+                    endGame();
+                }
+            }
 
+            if (changed) {
+                publishFrame();
+            }
+
+            // Cells only move a whole cell at a time, so there is nothing to interpolate
+            // between steps, the latest finished step is what gets drawn
+            if (now - lastRenderTime >= minFrameTime && renderFrame() > 0) {
+                lastRenderTime = now;
+                renderCounter++;
+            }
+        }
+
+        renderFrame();
+
+        showGameOver();
     }
 };
 
-#endif // SIMPLETETRIS_SCENERENDERER_H
\ No newline at end of file
+using SceneRenderer = BasicSceneRenderer<GameGrid>;
+
+#endif // SIMPLETETRIS_SCENERENDERER_H
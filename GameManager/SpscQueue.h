@@ -0,0 +1,57 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_SPSCQUEUE_H
+#define SIMPLETETRIS_SPSCQUEUE_H
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+// Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+// Capacity has to be a power of two so the indices can wrap with a mask.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    static constexpr std::size_t INDEX_MASK = Capacity - 1;
+
+    std::array<T, Capacity> slots{};
+
+    // head is only written by the consumer, tail only by the producer.
+    // Kept on separate cache lines so the two threads don't bounce one line between them.
+    alignas(64) std::atomic<std::size_t> head{0};
+    alignas(64) std::atomic<std::size_t> tail{0};
+
+public:
+
+    // Producer side: false if the queue is full and the value was dropped
+    bool push(const T& value) {
+        const std::size_t currentTail = tail.load(std::memory_order_relaxed);
+
+        if (currentTail - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        slots[currentTail & INDEX_MASK] = value;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: the oldest value, or nothing if the queue is empty
+    std::optional<T> pop() {
+        const std::size_t currentHead = head.load(std::memory_order_relaxed);
+
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+
+        T value = slots[currentHead & INDEX_MASK];
+        head.store(currentHead + 1, std::memory_order_release);
+        return value;
+    }
+};
+
+
+#endif //SIMPLETETRIS_SPSCQUEUE_H
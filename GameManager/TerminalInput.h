@@ -0,0 +1,210 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_TERMINALINPUT_H
+#define SIMPLETETRIS_TERMINALINPUT_H
+
+#ifndef _WIN32
+#include <array>
+#include <cstddef>
+#include <curses.h>  // only for the KEY_* codes, no curses calls happen here
+#include <poll.h>
+#include <unistd.h>
+
+// Reads keys straight from the terminal fd instead of going through getch(),
+// so the input thread can block in poll() and never needs the curses lock.
+// Arrow keys come back as the same KEY_* codes getch() would return.
+class TerminalInput {
+
+    static constexpr int INPUT_FD = STDIN_FILENO;
+    static constexpr unsigned char ESCAPE = 0x1b;
+
+    // how long an escape waits for the rest of its sequence before it counts as the escape key
+    static constexpr int ESCAPE_WAIT_MS = 25;
+
+    // interrupt() writes into this so a blocked poll() wakes up
+    int wakePipe[2]{-1, -1};
+
+    // an escape sequence split across two reads waits here for the rest
+    std::array<unsigned char, 8> pending{};
+    std::size_t pendingCount = 0;
+
+    static int decodeArrow(const unsigned char code) {
+        switch (code) {
+            case 'A': return KEY_UP;
+            case 'B': return KEY_DOWN;
+            case 'C': return KEY_RIGHT;
+            case 'D': return KEY_LEFT;
+            default: return ERR;
+        }
+    }
+
+    // Where the escape sequence starting at bytes[start] ends (one past its final byte),
+    // 0 if it isn't complete yet. CSI sequences (ESC [) can carry parameter and intermediate
+    // bytes before their final byte, like ESC [ 1 ; 5 D for ctrl+left or ESC [ 3 ~ for delete.
+    // SS3 ones (ESC O) are always one byte more.
+    static std::size_t sequenceEnd(const unsigned char* bytes, const std::size_t start, const std::size_t count) {
+        std::size_t end = start + 2;
+
+        if (bytes[start + 1] == '[') {
+            while (end < count && bytes[end] >= 0x20 && bytes[end] <= 0x3F) {
+                end++;
+            }
+        }
+
+        return end < count ? end + 1 : 0;
+    }
+
+    // Keeps bytes from start on for the next read, unless there's too many to be a real sequence
+    void keepPending(const unsigned char* bytes, const std::size_t start, const std::size_t count) {
+        pendingCount = count - start <= pending.size() ? count - start : 0;
+        for (std::size_t p = 0; p < pendingCount; p++) {
+            pending[p] = bytes[start + p];
+        }
+    }
+
+    // Hands every complete key in bytes to onKey, keeps an unfinished escape sequence for later
+    template <typename OnKey>
+    void decode(const unsigned char* bytes, const std::size_t count, OnKey& onKey) {
+        std::size_t i = 0;
+
+        while (i < count) {
+            if (bytes[i] != ESCAPE) {
+                onKey(static_cast<int>(bytes[i]));
+                i++;
+                continue;
+            }
+
+            if (count - i < 2) {
+                keepPending(bytes, i, count);
+                return;
+            }
+
+            if (bytes[i + 1] != '[' && bytes[i + 1] != 'O') {
+                // lone escape followed by a normal key
+                i++;
+                continue;
+            }
+
+            const std::size_t end = sequenceEnd(bytes, i, count);
+            if (end == 0) {
+                keepPending(bytes, i, count);
+                return;
+            }
+
+            // only the final byte says which key it was, the whole sequence is swallowed either way
+            const unsigned char finalByte = bytes[end - 1];
+            if (finalByte >= 0x40 && finalByte <= 0x7E) {
+                const int key = decodeArrow(finalByte);
+                if (key != ERR) {
+                    onKey(key);
+                }
+                i = end;
+            } else {
+                // not a valid final byte, drop what came before it and read it as a key
+                i = end - 1;
+            }
+        }
+    }
+
+    // Nothing more came after an escape, so it was the escape key. A sequence that stopped
+    // halfway is dropped, its bytes so far aren't keys the player typed.
+    template <typename OnKey>
+    void flushPending(OnKey& onKey) {
+        if (pendingCount > 0) {
+            onKey(static_cast<int>(pending[0]));
+        }
+        pendingCount = 0;
+    }
+
+public:
+    TerminalInput() {
+        if (pipe(wakePipe) != 0) {
+            wakePipe[0] = wakePipe[1] = -1;
+        }
+    }
+
+    ~TerminalInput() {
+        for (const int fd : wakePipe) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    TerminalInput(const TerminalInput&) = delete;
+    TerminalInput& operator=(const TerminalInput&) = delete;
+
+    // Blocks until keys arrive, then passes every key that is waiting to onKey in order.
+    // Gives up after timeoutMs (-1 waits forever, 0 only takes what is already there).
+    // Returns false once interrupt() was called.
+    template <typename OnKey>
+    bool waitForKeys(OnKey&& onKey, const int firstTimeoutMs = -1) {
+        pollfd fds[2] = {
+            {INPUT_FD, POLLIN, 0},
+            {wakePipe[0], POLLIN, 0}
+        };
+
+        int timeoutMs = firstTimeoutMs;
+        bool waitedForEscape = false;
+
+        // first poll blocks, the ones after it only drain what is already buffered
+        int ready;
+        while ((ready = poll(fds, 2, timeoutMs)) >= 0) {
+            if (ready == 0) {
+                // an unfinished escape sequence gets one short wait for the rest, then it's flushed
+                if (pendingCount == 0) {
+                    break;
+                }
+                if (waitedForEscape) {
+                    flushPending(onKey);
+                    break;
+                }
+                waitedForEscape = true;
+                timeoutMs = ESCAPE_WAIT_MS;
+                continue;
+            }
+
+            if (fds[1].revents & POLLIN) {
+                return false;
+            }
+
+            if ((fds[0].revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+                break;
+            }
+
+            std::array<unsigned char, 64> buffer{};
+            std::size_t count = pendingCount;
+            for (std::size_t p = 0; p < pendingCount; p++) {
+                buffer[p] = pending[p];
+            }
+            pendingCount = 0;
+
+            const ssize_t bytesRead = read(INPUT_FD, buffer.data() + count, buffer.size() - count);
+            if (bytesRead <= 0) {
+                // terminal went away, nothing more will ever arrive
+                return false;
+            }
+
+            count += static_cast<std::size_t>(bytesRead);
+            decode(buffer.data(), count, onKey);
+
+            timeoutMs = 0;
+        }
+
+        return true;
+    }
+
+    // Wakes up a thread blocked in waitForKeys(), safe to call from any thread
+    void interrupt() {
+        if (wakePipe[1] >= 0) {
+            const unsigned char wake = 1;
+            [[maybe_unused]] const ssize_t written = write(wakePipe[1], &wake, 1);
+        }
+    }
+};
+
+#endif // _WIN32
+
+#endif //SIMPLETETRIS_TERMINALINPUT_H
@@ -0,0 +1,63 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_TRIPLEBUFFER_H
+#define SIMPLETETRIS_TRIPLEBUFFER_H
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Hands whole values from one writer thread to one reader thread without locks.
+// The writer fills writeBuffer() and publishes it, the reader picks up the newest
+// published value with acquire(). Neither side ever waits on the other, and the
+// reader never sees a half written value.
+template <typename T>
+class TripleBuffer {
+
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t DIRTY = 0x4;
+
+    std::array<T, 3> buffers{};
+
+    // the buffer in between writer and reader, plus DIRTY if the reader hasn't taken it yet
+    std::atomic<std::uint8_t> middle{2};
+
+    // only touched by the writer
+    std::uint8_t writeIndex = 0;
+
+    // only touched by the reader
+    std::uint8_t readIndex = 1;
+
+public:
+
+    // Writer side: the buffer to fill before calling publish()
+    T& writeBuffer() {
+        return buffers[writeIndex];
+    }
+
+    // Writer side: hands the filled buffer over and takes the old middle one to write into next
+    void publish() {
+        const std::uint8_t previous = middle.exchange(writeIndex | DIRTY, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    // Reader side: switches to the newest published buffer, false if nothing new was published
+    bool acquire() {
+        if ((middle.load(std::memory_order_relaxed) & DIRTY) == 0) {
+            return false;
+        }
+
+        const std::uint8_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    // Reader side: the buffer picked up by the last acquire()
+    const T& readBuffer() const {
+        return buffers[readIndex];
+    }
+};
+
+
+#endif //SIMPLETETRIS_TRIPLEBUFFER_H
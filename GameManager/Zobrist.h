@@ -0,0 +1,50 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_ZOBRIST_H
+#define SIMPLETETRIS_ZOBRIST_H
+#include <array>
+#include <cstdint>
+
+#include "Blocks/PieceTables.h"
+
+// Random keys for Zobrist hashing: a board hashes to the XOR of the keys of its filled cells,
+// so locking or clearing cells updates the hash with a few XORs. The keys are made at
+// compile time from splitmix64 and are the same in every build.
+namespace Zobrist {
+
+    constexpr std::uint64_t splitmix64(std::uint64_t x) {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    template <int Width, int Height>
+    constexpr std::array<std::array<std::uint64_t, Width>, Height> makeCellKeys() {
+        std::array<std::array<std::uint64_t, Width>, Height> keys{};
+        for (int y = 0; y < Height; y++) {
+            for (int x = 0; x < Width; x++) {
+                keys[y][x] = splitmix64(static_cast<std::uint64_t>(y) * 64 + x);
+            }
+        }
+        return keys;
+    }
+
+    // [row][column]
+    template <int Width, int Height>
+    inline constexpr auto CELL_KEYS = makeCellKeys<Width, Height>();
+
+    // for search positions, which also depend on the piece to place and how far down the queue it is
+    constexpr std::uint64_t pieceKey(const BlockType type) {
+        return splitmix64(0x5049454345ull + static_cast<std::uint64_t>(type));
+    }
+
+    constexpr std::uint64_t queueKey(const std::uint64_t queueIndex) {
+        return splitmix64(0x5155455545ull ^ (queueIndex * 0x9E3779B97F4A7C15ull));
+    }
+}
+
+
+#endif //SIMPLETETRIS_ZOBRIST_H
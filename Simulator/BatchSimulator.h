@@ -0,0 +1,211 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_BATCHSIMULATOR_H
+#define SIMPLETETRIS_BATCHSIMULATOR_H
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "enums.h"
+#include "WorkStealingPool.h"
+#include "Bot/Lookahead.h"
+#include "Diagnostics/AllocationCounter.h"
+#include "GameManager/GameState.h"
+#include "GameManager/Randomizer.h"
+
+// Who presses the buttons in a simulated game
+enum class SimPolicy {
+    RANDOM,   // one uniformly random move every frame
+    SCRIPTED, // the script's moves over and over, one per frame
+    BOT       // the lookahead bot, one whole piece per frame
+};
+
+struct SimConfig {
+    // plays one game per seed in [seedBegin, seedEnd)
+    std::uint64_t seedBegin = 0;
+    std::uint64_t seedEnd = 1000;
+
+    int threads = 1;
+
+    SimPolicy policy = SimPolicy::RANDOM;
+    std::vector<BlockMove> script;
+
+    // games still going after this many pieces are cut off
+    std::uint64_t maxPieces = 10000;
+
+    double gravity = 1.0 / 18;
+
+    BotWeights botWeights;
+    LookaheadConfig lookahead;
+};
+
+struct SimResults {
+    std::uint64_t games = 0;
+    // games that hit maxPieces instead of topping out
+    std::uint64_t gamesCutOff = 0;
+
+    // summed over all games
+    GameStats totals;
+
+    // the bots' transposition tables
+    std::uint64_t tableProbes = 0;
+    std::uint64_t tableHits = 0;
+
+    // the bots' search arenas, and heap allocations the bots made after their first piece
+    std::size_t arenaPeakBytes = 0;
+    std::uint64_t arenaSystemAllocations = 0;
+    std::uint64_t searchAllocations = 0;
+
+    std::chrono::duration<double> elapsed{};
+
+    void add(const SimResults& other) {
+        games += other.games;
+        gamesCutOff += other.gamesCutOff;
+        tableProbes += other.tableProbes;
+        tableHits += other.tableHits;
+        arenaPeakBytes = std::max(arenaPeakBytes, other.arenaPeakBytes);
+        arenaSystemAllocations += other.arenaSystemAllocations;
+        searchAllocations += other.searchAllocations;
+
+        totals.frames += other.totals.frames;
+        totals.piecesPlaced += other.totals.piecesPlaced;
+        totals.linesCleared += other.totals.linesCleared;
+        for (std::size_t lines = 0; lines < totals.clearsByLines.size(); lines++) {
+            totals.clearsByLines[lines] += other.totals.clearsByLines[lines];
+        }
+    }
+};
+
+// Plays many headless games across threads and adds up what happened
+class BatchSimulator {
+
+    static constexpr std::array<BlockMove, 6> ALL_MOVES{
+        BlockMove::ROTATE, BlockMove::ROTATE_CCW, BlockMove::LEFT,
+        BlockMove::RIGHT, BlockMove::DOWN, BlockMove::QUICK_DOWN
+    };
+
+    // Per thread: its own game, bot and totals, merged once at the end
+    struct alignas(64) Worker {
+        GameState state;
+        Lookahead lookahead;
+        SimResults results;
+
+        // the first search sizes the arena, it may allocate
+        bool searchWarmedUp = false;
+
+        explicit Worker(const SimConfig& config) : lookahead(config.lookahead, config.botWeights) {
+        }
+    };
+
+    SimConfig config;
+
+    void playGame(Worker& worker, const std::uint64_t seed) const {
+        GameState& state = worker.state;
+        state.setGravity(config.gravity);
+        state.start(seed);
+
+        // the policy's own generator, so the moves depend on the seed too
+        Xoshiro256 policyRng(~seed);
+        std::size_t scriptIndex = 0;
+
+        // table entries only hold for one piece sequence
+        if (config.policy == SimPolicy::BOT) {
+            worker.lookahead.clearTable();
+        }
+
+        Lookahead::Moves botMoves;
+        std::array<BlockType, BagRandomizer::MAX_PREVIEW> preview{};
+
+        while (!state.isGameOver() && state.getStats().piecesPlaced < config.maxPieces) {
+            BlockMove move = BlockMove::DOWN;
+
+            switch (config.policy) {
+                case SimPolicy::RANDOM:
+                    move = ALL_MOVES[policyRng.nextBelow(ALL_MOVES.size())];
+                    break;
+
+                case SimPolicy::SCRIPTED:
+                    if (config.script.empty()) {
+                        state.step();
+                        continue;
+                    }
+                    move = config.script[scriptIndex];
+                    scriptIndex = (scriptIndex + 1) % config.script.size();
+                    break;
+
+                case SimPolicy::BOT: {
+                    for (int i = 0; i < state.getPreviewCount(); i++) {
+                        preview[i] = state.getPreview(i);
+                    }
+
+                    const std::size_t allocationsBefore = AllocationCounter::threadAllocations();
+
+                    // the plan ends in a hard drop, so every frame places a piece
+                    const int count = worker.lookahead.plan(state.getGrid(), *state.getActiveBlock(),
+                                                            std::span(preview.data(), state.getPreviewCount()),
+                                                            state.getStats().piecesPlaced, botMoves);
+
+                    if (worker.searchWarmedUp) {
+                        worker.results.searchAllocations += AllocationCounter::threadAllocations() - allocationsBefore;
+                    }
+                    worker.searchWarmedUp = true;
+
+                    state.step(std::span<const BlockMove>(botMoves.data(), count));
+                    continue;
+                }
+            }
+
+            state.step({&move, 1});
+        }
+
+        worker.results.games++;
+        if (!state.isGameOver()) {
+            worker.results.gamesCutOff++;
+        }
+
+        SimResults game;
+        game.totals = state.getStats();
+        worker.results.add(game);
+    }
+
+public:
+    explicit BatchSimulator(SimConfig config) : config(std::move(config)) {
+    }
+
+    SimResults run() {
+        const int threads = config.threads > 0 ? config.threads : 1;
+        std::vector<std::unique_ptr<Worker>> workers;
+        for (int i = 0; i < threads; i++) {
+            workers.push_back(std::make_unique<Worker>(config));
+        }
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        WorkStealingPool pool;
+        pool.run(config.seedBegin, config.seedEnd, threads,
+                 [this, &workers](const int worker, const std::uint64_t seed) {
+                     playGame(*workers[worker], seed);
+                 });
+
+        SimResults results;
+        for (const auto& worker : workers) {
+            results.add(worker->results);
+            results.tableProbes += worker->lookahead.getTableStats().probes;
+            results.tableHits += worker->lookahead.getTableStats().hits;
+            results.arenaPeakBytes = std::max(results.arenaPeakBytes, worker->lookahead.getArenaStats().peakBytes);
+            results.arenaSystemAllocations += worker->lookahead.getArenaStats().systemAllocations;
+        }
+        results.elapsed = std::chrono::steady_clock::now() - startTime;
+
+        return results;
+    }
+};
+
+
+#endif //SIMPLETETRIS_BATCHSIMULATOR_H
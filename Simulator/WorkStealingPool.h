@@ -0,0 +1,126 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#ifndef SIMPLETETRIS_WORKSTEALINGPOOL_H
+#define SIMPLETETRIS_WORKSTEALINGPOOL_H
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs fn(worker, index) for every index in [begin, end) on a number of threads.
+// Each worker starts with an equal slice and works through it front to back; one that
+// runs dry steals the back half of someone else's slice, so uneven jobs (games that
+// last 10 pieces next to games that last 10000) still keep every core busy.
+class WorkStealingPool {
+
+    // One worker's remaining slice, on its own cache line so owners don't slow each other down
+    struct alignas(64) Slice {
+        std::mutex mutex;
+        std::uint64_t next = 0;
+        std::uint64_t end = 0;
+    };
+
+    std::vector<std::unique_ptr<Slice>> slices;
+
+    // Takes the next index of worker's own slice
+    bool popOwn(const int worker, std::uint64_t& index) {
+        Slice& slice = *slices[worker];
+        std::lock_guard<std::mutex> lock(slice.mutex);
+
+        if (slice.next == slice.end) {
+            return false;
+        }
+
+        index = slice.next++;
+        return true;
+    }
+
+    // Moves the back half of the first non-empty victim into worker's slice
+    bool steal(const int worker) {
+        const int count = static_cast<int>(slices.size());
+
+        for (int offset = 1; offset < count; offset++) {
+            Slice& victim = *slices[(worker + offset) % count];
+
+            std::uint64_t stolenBegin;
+            std::uint64_t stolenEnd;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+
+                const std::uint64_t remaining = victim.end - victim.next;
+                if (remaining == 0) {
+                    continue;
+                }
+
+                // leave the victim the front half, it is working there
+                stolenEnd = victim.end;
+                stolenBegin = victim.end - (remaining + 1) / 2;
+                victim.end = stolenBegin;
+            }
+
+            Slice& own = *slices[worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.next = stolenBegin;
+            own.end = stolenEnd;
+            return true;
+        }
+
+        // Every slice is empty, so this worker can stop. A range that's in the middle of being
+        // stolen (already taken from its victim, not in the thief's slice yet) doesn't need
+        // anyone else: its thief goes on to play it.
+        return false;
+    }
+
+    // Where worker's share of total starts, the first total % threads workers get one extra.
+    // No total * worker here, that overflows for ranges near the top of 64 bits.
+    static std::uint64_t sliceStart(const std::uint64_t total, const int worker, const int threads) {
+        const auto count = static_cast<std::uint64_t>(threads);
+        const auto index = static_cast<std::uint64_t>(worker);
+        return total / count * index + std::min(index, total % count);
+    }
+
+public:
+    template <typename Fn>
+    void run(const std::uint64_t begin, const std::uint64_t end, int threads, Fn&& fn) {
+        threads = std::max(threads, 1);
+
+        slices.clear();
+        const std::uint64_t total = end > begin ? end - begin : 0;
+        for (int worker = 0; worker < threads; worker++) {
+            auto slice = std::make_unique<Slice>();
+            slice->next = begin + sliceStart(total, worker, threads);
+            slice->end = begin + sliceStart(total, worker + 1, threads);
+            slices.push_back(std::move(slice));
+        }
+
+        const auto work = [this, &fn](const int worker) {
+            std::uint64_t index;
+            while (true) {
+                if (popOwn(worker, index)) {
+                    fn(worker, index);
+                } else if (!steal(worker)) {
+                    break;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (int worker = 1; worker < threads; worker++) {
+            workers.emplace_back(work, worker);
+        }
+
+        // the calling thread is worker 0
+        work(0);
+
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+};
+
+
+#endif //SIMPLETETRIS_WORKSTEALINGPOOL_H
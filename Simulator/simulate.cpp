@@ -0,0 +1,153 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+
+#include "BatchSimulator.h"
+
+namespace {
+
+    void printUsage() {
+        std::printf(
+            "usage: TetrisSim [--seeds FIRST:LAST] [--threads N] [--policy random|scripted|bot]\n"
+            "                 [--script MOVES] [--max-pieces N] [--gravity CELLS_PER_FRAME]\n"
+            "                 [--depth PIECES] [--beam WIDTH] [--budget MICROSECONDS] [--table MEGABYTES]\n"
+            "MOVES is one letter per frame: l r d (down) h (hard drop) c (clockwise) a (counter-clockwise)\n");
+    }
+
+    // Turns "lrch" into moves, false on an unknown letter
+    bool parseScript(const std::string_view text, std::vector<BlockMove>& script) {
+        for (const char letter : text) {
+            switch (letter) {
+                case 'l': script.push_back(BlockMove::LEFT); break;
+                case 'r': script.push_back(BlockMove::RIGHT); break;
+                case 'd': script.push_back(BlockMove::DOWN); break;
+                case 'h': script.push_back(BlockMove::QUICK_DOWN); break;
+                case 'c': script.push_back(BlockMove::ROTATE); break;
+                case 'a': script.push_back(BlockMove::ROTATE_CCW); break;
+                default: return false;
+            }
+        }
+        return true;
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+    SimConfig config;
+    config.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--seeds" && hasValue) {
+            // FIRST:LAST plays LAST - FIRST games, a single number N plays seeds 0 to N - 1
+            char* rest = nullptr;
+            const std::uint64_t first = std::strtoull(argv[++i], &rest, 10);
+            if (*rest == ':') {
+                config.seedBegin = first;
+                config.seedEnd = std::strtoull(rest + 1, nullptr, 10);
+            } else {
+                config.seedBegin = 0;
+                config.seedEnd = first;
+            }
+        } else if (arg == "--threads" && hasValue) {
+            // 0 is also what a non-number parses as
+            config.threads = std::atoi(argv[++i]);
+            if (config.threads < 1) {
+                printUsage();
+                return 1;
+            }
+        } else if (arg == "--policy" && hasValue) {
+            const std::string_view policy(argv[++i]);
+            if (policy == "random") {
+                config.policy = SimPolicy::RANDOM;
+            } else if (policy == "scripted") {
+                config.policy = SimPolicy::SCRIPTED;
+            } else if (policy == "bot") {
+                config.policy = SimPolicy::BOT;
+            } else {
+                printUsage();
+                return 1;
+            }
+        } else if (arg == "--script" && hasValue) {
+            config.script.clear();
+            if (!parseScript(argv[++i], config.script)) {
+                printUsage();
+                return 1;
+            }
+        } else if (arg == "--max-pieces" && hasValue) {
+            config.maxPieces = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--gravity" && hasValue) {
+            config.gravity = std::atof(argv[++i]);
+        } else if (arg == "--depth" && hasValue) {
+            config.lookahead.maxDepth = std::atoi(argv[++i]);
+        } else if (arg == "--beam" && hasValue) {
+            config.lookahead.beamWidth = std::atoi(argv[++i]);
+        } else if (arg == "--budget" && hasValue) {
+            config.lookahead.timeBudget = std::chrono::microseconds(std::atoll(argv[++i]));
+        } else if (arg == "--table" && hasValue) {
+            config.lookahead.tableMegabytes = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (config.policy == SimPolicy::SCRIPTED && config.script.empty()) {
+        // shift left, spin, then slam: fills the left side until it tops out
+        parseScript("llch", config.script);
+    }
+
+    BatchSimulator simulator(config);
+    const SimResults results = simulator.run();
+
+    const double seconds = results.elapsed.count();
+    const GameStats& totals = results.totals;
+
+    std::printf("%llu games on %d threads in %.3f s (%llu cut off at %llu pieces)\n",
+                static_cast<unsigned long long>(results.games), config.threads, seconds,
+                static_cast<unsigned long long>(results.gamesCutOff),
+                static_cast<unsigned long long>(config.maxPieces));
+    std::printf("games/sec  %.1f\n", results.games / seconds);
+    std::printf("pieces/sec %.1f\n", totals.piecesPlaced / seconds);
+    std::printf("frames/sec %.1f\n", totals.frames / seconds);
+
+    if (results.games > 0) {
+        std::printf("pieces/game %.2f, lines/game %.2f\n",
+                    static_cast<double>(totals.piecesPlaced) / results.games,
+                    static_cast<double>(totals.linesCleared) / results.games);
+    }
+
+    if (results.tableProbes > 0) {
+        std::printf("transposition table: %llu probes, %.2f%% hits\n",
+                    static_cast<unsigned long long>(results.tableProbes),
+                    100.0 * results.tableHits / results.tableProbes);
+    }
+
+    if (config.policy == SimPolicy::BOT) {
+        std::printf("search arena: %.1f KiB peak, %llu system allocations, %llu heap allocations after warm-up\n",
+                    results.arenaPeakBytes / 1024.0,
+                    static_cast<unsigned long long>(results.arenaSystemAllocations),
+                    static_cast<unsigned long long>(results.searchAllocations));
+        std::printf("feature kernel: %s\n", FeatureKernels::selectedName());
+    }
+
+    // How the locks split up by rows cleared
+    std::printf("line clears:");
+    for (std::size_t lines = 0; lines < totals.clearsByLines.size(); lines++) {
+        const double share = totals.piecesPlaced > 0
+                                 ? 100.0 * totals.clearsByLines[lines] / totals.piecesPlaced
+                                 : 0.0;
+        std::printf("  %zu: %llu (%.2f%%)", lines,
+                    static_cast<unsigned long long>(totals.clearsByLines[lines]), share);
+    }
+    std::printf("\n");
+
+    return 0;
+}
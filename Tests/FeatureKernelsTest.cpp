@@ -0,0 +1,166 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+// Checks every feature kernel this CPU can run, the templated scalar loop and the column
+// heights against a cell by cell reference on random boards of a few sizes. The dispatcher
+// picks a kernel from the host CPU, so all of them get checked, not just the one in use.
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Bot/BoardFeatures.h"
+#include "GameManager/GameGrid.h"
+#include "GameManager/Randomizer.h"
+
+namespace {
+    // The features straight from their definitions, one cell at a time
+    template <typename Grid>
+    BoardFeatures reference(const std::span<const typename Grid::RowMask, Grid::HEIGHT> rows,
+                            std::array<std::int32_t, Grid::WIDTH>& heights) {
+        // outside the sides and below the floor counts as filled, above the top as empty
+        const auto filled = [&rows](const int x, const int y) {
+            if (x < 0 || x >= Grid::WIDTH || y >= Grid::HEIGHT) {
+                return true;
+            }
+            return y >= 0 && (rows[y] & Grid::columnBit(x)) != 0;
+        };
+
+        BoardFeatures features;
+
+        for (int x = 0; x < Grid::WIDTH; x++) {
+            heights[x] = 0;
+            for (int y = 0; y < Grid::HEIGHT; y++) {
+                if (filled(x, y)) {
+                    heights[x] = Grid::HEIGHT - y;
+                    break;
+                }
+            }
+
+            const int top = Grid::HEIGHT - heights[x];
+            for (int y = top; y < Grid::HEIGHT; y++) {
+                features.holes += !filled(x, y);
+            }
+            for (int y = 0; y <= Grid::HEIGHT; y++) {
+                features.columnTransitions += filled(x, y) != filled(x, y - 1);
+            }
+            for (int y = 0; y < top; y++) {
+                features.wells += filled(x - 1, y) && filled(x + 1, y);
+            }
+
+            features.aggregateHeight += heights[x];
+            features.maxHeight = std::max(features.maxHeight, heights[x]);
+            if (x > 0) {
+                features.bumpiness += std::abs(heights[x] - heights[x - 1]);
+            }
+        }
+
+        for (int y = 0; y < Grid::HEIGHT; y++) {
+            for (int x = -1; x < Grid::WIDTH; x++) {
+                features.rowTransitions += filled(x, y) != filled(x + 1, y);
+            }
+        }
+
+        return features;
+    }
+
+    bool sameFeatures(const BoardFeatures& a, const BoardFeatures& b) {
+        return std::memcmp(&a, &b, sizeof(BoardFeatures)) == 0;
+    }
+
+    void printFeatures(const char* label, const BoardFeatures& f) {
+        std::printf("  %-8s height %d max %d holes %d bumpiness %d lines %d row %d column %d wells %d\n", label,
+                    f.aggregateHeight, f.maxHeight, f.holes, f.bumpiness, f.linesCleared,
+                    f.rowTransitions, f.columnTransitions, f.wells);
+    }
+
+    // Boards from empty to full, stacks with random cells and some all empty or all full rows
+    template <typename Grid>
+    int checkBoards(const int boards, Xoshiro256& rng) {
+        using RowMask = typename Grid::RowMask;
+        int failures = 0;
+
+        for (int board = 0; board < boards; board++) {
+            std::array<RowMask, Grid::HEIGHT> rows{};
+            const int top = static_cast<int>(rng.nextBelow(Grid::HEIGHT + 1));
+
+            for (int y = top; y < Grid::HEIGHT; y++) {
+                switch (rng.nextBelow(8)) {
+                    case 0: rows[y] = 0; break;
+                    case 1: rows[y] = Grid::PLAYFIELD; break;
+                    case 2: rows[y] = static_cast<RowMask>(rng.next() & rng.next()); break;
+                    default: rows[y] = static_cast<RowMask>(rng.next() | rng.next()); break;
+                }
+                rows[y] = static_cast<RowMask>((rows[y] & Grid::PLAYFIELD) | Grid::EMPTY_ROW);
+            }
+            for (int y = 0; y < top; y++) {
+                rows[y] = Grid::EMPTY_ROW;
+            }
+
+            Grid grid;
+            grid.load(rows, BlockColor::GREEN);
+
+            std::array<std::int32_t, Grid::WIDTH> expectedHeights{};
+            const BoardFeatures expected = reference<Grid>(rows, expectedHeights);
+
+            bool ok = true;
+            const auto check = [&](const char* label, const BoardFeatures& got) {
+                if (!sameFeatures(got, expected)) {
+                    if (failures < 5) {
+                        std::printf("%dx%d board %d, %s differs:\n", Grid::WIDTH, Grid::HEIGHT, board, label);
+                        printFeatures("expected", expected);
+                        printFeatures("got", got);
+                    }
+                    ok = false;
+                }
+            };
+
+            check("templated scalar", extractFeaturesScalar<Grid>(rows, 0));
+            check("dispatched", extractFeatures<Grid>(rows, 0));
+
+            if constexpr (std::is_same_v<RowMask, std::uint16_t> && Grid::HEIGHT <= FeatureKernels::MAX_ROWS) {
+                for (const auto& [name, kernel] : FeatureKernels::availableKernels()) {
+                    check(name, kernel(rows.data(), FeatureKernels::LAYOUT<Grid>));
+                }
+            }
+
+            if (columnHeights(grid) != expectedHeights || columnHeights<Grid>(rows) != expectedHeights) {
+                if (failures < 5) {
+                    std::printf("%dx%d board %d: column heights differ\n", Grid::WIDTH, Grid::HEIGHT, board);
+                }
+                ok = false;
+            }
+
+            failures += !ok;
+        }
+
+        return failures;
+    }
+}
+
+int main() {
+    Xoshiro256 rng(25);
+
+    std::printf("kernels:");
+    for (const auto& [name, kernel] : FeatureKernels::availableKernels()) {
+        std::printf(" %s", name);
+    }
+    std::printf(" (dispatching to %s)\n", FeatureKernels::selectedName());
+
+    int failures = 0;
+    failures += checkBoards<GameGrid>(200000, rng);
+    // partial last registers for every kernel
+    failures += checkBoards<BasicGameGrid<10, 20>>(50000, rng);
+    failures += checkBoards<BasicGameGrid<8, 16>>(50000, rng);
+    failures += checkBoards<BasicGameGrid<10, 13>>(50000, rng);
+    failures += checkBoards<BasicGameGrid<10, 32>>(50000, rng);
+    // past what the kernels take, these go through the templated loop
+    failures += checkBoards<BasicGameGrid<10, 40>>(20000, rng);
+    failures += checkBoards<BasicGameGrid<20, 30>>(20000, rng);
+
+    std::printf("%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+// Turns an I piece around on the floor every frame. Its box y changes with the turns while
+// its lowest cell stays on the same row, so none of that may earn the lock resets back:
+// the piece has to lock once its 15 resets and one more lock delay are used up.
+
+#include <array>
+#include <cstdio>
+#include <memory>
+
+#include "GameManager/GameState.h"
+
+namespace {
+    constexpr auto LOCK_DELAY = std::chrono::milliseconds(500);
+    constexpr int LOCK_DELAY_FRAMES = static_cast<int>(LOCK_DELAY / GravityScheduler::FRAME) + 1;
+    // every reset takes a turn plus up to two pushes back down (an I kicks up two rows at most),
+    // then the last lock delay runs out
+    constexpr int SPIN_LIMIT = 3 * (GravityScheduler::MAX_LOCK_RESETS + 1) + LOCK_DELAY_FRAMES;
+
+    // a seed whose first piece is an I
+    std::uint64_t seedStartingWithI(GameState& state) {
+        for (std::uint64_t seed = 1;; seed++) {
+            state.start(seed);
+            if (state.getActiveBlock()->getType() == BlockType::I) {
+                return seed;
+            }
+        }
+    }
+
+    // Frames until the first piece locks with nobody touching it, -1 if it never does
+    int framesUntilLock(GameState& state, const int maxFrames) {
+        for (int frame = 1; frame <= maxFrames; frame++) {
+            state.step();
+
+            if (state.getStats().piecesPlaced > 0) {
+                return frame;
+            }
+        }
+        return -1;
+    }
+}
+
+int main() {
+    const auto state = std::make_unique<GameState>();
+    state->setLockDelay(LOCK_DELAY);
+    // 20G, the piece is on the floor in its first frame
+    state->setGravity(20);
+
+    int failures = 0;
+
+    // left alone it locks after one lock delay
+    state->start(seedStartingWithI(*state));
+    const int idleFrames = framesUntilLock(*state, 1000);
+    if (idleFrames < 0 || idleFrames > LOCK_DELAY_FRAMES + 2) {
+        std::printf("idle piece locked after %d frames, expected about %d\n", idleFrames, LOCK_DELAY_FRAMES);
+        failures++;
+    }
+
+    // Without gravity the piece only falls when told to. It starts upside down (I state 2, box y
+    // one row above state 0's on the floor) and gets pushed down to the floor. Then it turns
+    // every frame, pushed back down whenever a turn lifted it: first back and forth between
+    // upside down and upright to use up most of the resets, then on round to flat (state 0),
+    // whose box sits a row lower though its cells don't. That mustn't give the resets back.
+    state->setGravity(0);
+    state->start(seedStartingWithI(*state));
+
+    const std::array spawnTurn{BlockMove::ROTATE, BlockMove::ROTATE};
+    state->step(spawnTurn);
+
+    int spinFrames = -1;
+    int turns = 0;
+    for (int frame = 1; frame <= 10000 && spinFrames < 0; frame++) {
+        BlockMove move = BlockMove::DOWN;
+        if (!state->getActiveBlock()->canMoveDown()) {
+            const bool backAndForth = turns < GravityScheduler::MAX_LOCK_RESETS - 1;
+            move = backAndForth && turns % 2 == 0 ? BlockMove::ROTATE : BlockMove::ROTATE_CCW;
+            turns++;
+        }
+        state->step(std::span<const BlockMove>(&move, 1));
+
+        if (state->getStats().piecesPlaced > 0) {
+            spinFrames = frame;
+        }
+    }
+
+    if (spinFrames < 0 || spinFrames > SPIN_LIMIT) {
+        std::printf("spinning piece locked after %d frames, the reset cap allows %d\n", spinFrames, SPIN_LIMIT);
+        failures++;
+    }
+
+    std::printf("idle lock after %d frames, spinning lock after %d, %d failures\n", idleFrames, spinFrames, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+// Plays random stacks of place() calls on boards full of nearly complete rows, then takes
+// them all back with unplace() and checks the grid comes back exactly as it was at every level.
+
+#include <array>
+#include <cstdio>
+#include <vector>
+
+#include "Bot/PlacementSearch.h"
+#include "GameManager/GameGrid.h"
+#include "GameManager/GameState.h"
+#include "GameManager/Randomizer.h"
+
+namespace {
+    using Search = BasicPlacementSearch<GameGrid>;
+
+    // rows, colors, hash and the column plane (seen through dropDistance) all have to match
+    bool sameGrid(const GameGrid& a, const GameGrid& b) {
+        if (a.getHash() != b.getHash() || a.getLastRowsCleared() != b.getLastRowsCleared()) {
+            return false;
+        }
+
+        for (int y = 0; y < GameGrid::HEIGHT; y++) {
+            if (a.getRow(y) != b.getRow(y)) {
+                return false;
+            }
+            for (int x = 0; x < GameGrid::WIDTH; x++) {
+                if (a.getColorAt({x, y}) != b.getColorAt({x, y})) {
+                    return false;
+                }
+            }
+        }
+
+        for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+            for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+                const PieceShape& shape = pieceShape(static_cast<BlockType>(type), rotation);
+                for (int x = -GameGrid::WALL_BITS; x < GameGrid::WIDTH; x++) {
+                    const Point top{x, 0};
+                    if (a.fits(shape, top) != b.fits(shape, top)) {
+                        return false;
+                    }
+                    if (a.fits(shape, top) && a.dropDistance(shape, top) != b.dropDistance(shape, top)) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // the bottom half gets rows with two holes each, so placements keep clearing lines
+    void fillGarbage(GameGrid& grid, Xoshiro256& rng) {
+        std::array<GameGrid::RowMask, GameGrid::HEIGHT> rows{};
+
+        for (int y = GameGrid::HEIGHT / 2; y < GameGrid::HEIGHT; y++) {
+            const int hole = static_cast<int>(rng.nextBelow(GameGrid::WIDTH));
+            rows[y] = GameGrid::PLAYFIELD & static_cast<GameGrid::RowMask>(~(GameGrid::columnBit(hole)
+                                                                            | GameGrid::columnBit((hole + 1) % GameGrid::WIDTH)));
+        }
+
+        grid.load(rows, BlockColor::BLUE);
+    }
+}
+
+int main() {
+    constexpr int boards = 300;
+    constexpr int stackDepth = 40;
+
+    Xoshiro256 rng(9);
+    int failures = 0;
+    long placed = 0;
+    long linesCleared = 0;
+
+    for (int board = 0; board < boards; board++) {
+        GameGrid grid;
+        fillGarbage(grid, rng);
+
+        std::vector<GameGrid> before;
+        std::vector<GameGrid::PlaceRecord> records;
+
+        for (int i = 0; i < stackDepth; i++) {
+            const auto type = static_cast<BlockType>(rng.nextBelow(PIECE_TYPE_COUNT));
+
+            std::array<Placement, Search::MAX_PLACEMENTS> placements;
+            const int count = Search::enumerate(grid.getRows(), type, 0, GameState::SPAWN_POSITION,
+                                                RotationSystems::SRS, placements);
+            if (count == 0) {
+                break;
+            }
+
+            // mostly the placement that clears the most, so the clear path gets a real workout
+            Placement chosen = placements[rng.nextBelow(count)];
+            if (rng.nextBelow(4) != 0) {
+                int mostLines = 0;
+                for (int p = 0; p < count; p++) {
+                    Search::Rows rows;
+                    std::copy(grid.getRows().begin(), grid.getRows().end(), rows.begin());
+                    const int lines = Search::land(rows, placements[p]);
+                    if (lines > mostLines) {
+                        mostLines = lines;
+                        chosen = placements[p];
+                    }
+                }
+            }
+
+            before.push_back(grid);
+            records.push_back(grid.place(pieceShape(type, chosen.rotation), chosen.position, pieceColor(type)));
+            placed++;
+            linesCleared += grid.getLastRowsCleared();
+
+            if (grid.getHash() != GameGrid::hashRows(grid.getRows())) {
+                std::printf("board %d, place %d: incremental hash drifted\n", board, i);
+                failures++;
+            }
+        }
+
+        for (int level = static_cast<int>(records.size()) - 1; level >= 0; level--) {
+            grid.unplace(records[level]);
+            if (!sameGrid(grid, before[level])) {
+                std::printf("board %d: unplace of place %d didn't restore the grid\n", board, level);
+                failures++;
+            }
+        }
+    }
+
+    std::printf("%ld placements, %ld lines cleared, %d failures\n", placed, linesCleared, failures);
+    return failures == 0 && linesCleared > 0 ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+// Checks the bit-parallel flood against a plain breadth-first search over (rotation, x, y)
+// that moves a piece one step at a time through the grid and the rotation system, on random
+// boards with overhangs. Then plays every placement's move list on a real Block and checks
+// it ends up where the placement said.
+
+#include <array>
+#include <cstdio>
+#include <queue>
+#include <set>
+#include <tuple>
+
+#include "Blocks/Block.h"
+#include "Bot/PlacementSearch.h"
+#include "Bot/Reachability.h"
+#include "GameManager/GameGrid.h"
+#include "GameManager/GameState.h"
+#include "GameManager/Randomizer.h"
+
+namespace {
+    using Reachability = BasicReachability<GameGrid>;
+    using Search = BasicPlacementSearch<GameGrid>;
+    using State = std::tuple<int, int, int>;
+
+    // every (rotation, x, y) reachable from the start, one move at a time
+    std::set<State> bruteForce(const GameGrid& grid, const BlockType type, const Point start) {
+        std::set<State> seen{{0, start.x, start.y}};
+        std::queue<State> queue;
+        queue.push({0, start.x, start.y});
+
+        const auto visit = [&](const int rotation, const int x, const int y) {
+            if (seen.insert({rotation, x, y}).second) {
+                queue.push({rotation, x, y});
+            }
+        };
+
+        while (!queue.empty()) {
+            const auto [rotation, x, y] = queue.front();
+            queue.pop();
+
+            const PieceShape& shape = pieceShape(type, rotation);
+            for (const Point step : {Point{-1, 0}, Point{1, 0}, Point{0, 1}}) {
+                if (grid.fits(shape, {x + step.x, y + step.y})) {
+                    visit(rotation, x + step.x, y + step.y);
+                }
+            }
+
+            for (const auto direction : {RotationDirection::CLOCKWISE, RotationDirection::COUNTER_CLOCKWISE}) {
+                int newRotation = rotation;
+                Point position{x, y};
+                if (RotationSystems::SRS.tryRotate(grid, type, newRotation, position, direction)) {
+                    visit(newRotation, position.x, position.y);
+                }
+            }
+        }
+
+        return seen;
+    }
+
+    // random cells below a random height, so there are overhangs and tucks to find
+    void fillRandom(GameGrid& grid, Xoshiro256& rng) {
+        std::array<GameGrid::RowMask, GameGrid::HEIGHT> rows{};
+        const int top = 8 + static_cast<int>(rng.nextBelow(GameGrid::HEIGHT - 10));
+
+        for (int y = top; y < GameGrid::HEIGHT; y++) {
+            for (int x = 0; x < GameGrid::WIDTH; x++) {
+                if (rng.nextBelow(100) < 45) {
+                    rows[y] |= GameGrid::columnBit(x);
+                }
+            }
+        }
+
+        grid.load(rows, BlockColor::RED);
+    }
+}
+
+int main() {
+    constexpr int boards = 3000;
+    constexpr Point start = GameState::SPAWN_POSITION;
+
+    Xoshiro256 rng(5);
+    int failures = 0;
+    long reachableTotal = 0;
+    long pathsPlayed = 0;
+
+    for (int board = 0; board < boards; board++) {
+        GameGrid grid;
+        fillRandom(grid, rng);
+
+        const auto type = static_cast<BlockType>(rng.nextBelow(PIECE_TYPE_COUNT));
+        if (!grid.fits(pieceShape(type, 0), start)) {
+            continue;
+        }
+
+        Reachability reachability;
+        reachability.compute(grid.getRows(), type, 0, start);
+        const auto expected = bruteForce(grid, type, start);
+
+        for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+            for (int y = -Reachability::ROW_OFFSET; y < GameGrid::HEIGHT; y++) {
+                for (int x = -GameGrid::WALL_BITS; x < GameGrid::WIDTH; x++) {
+                    const bool reached = reachability.isReachable(rotation, {x, y});
+                    if (reached != expected.contains({rotation, x, y})) {
+                        std::printf("board %d, piece %d: rotation %d at (%d, %d) is %s by the flood only\n",
+                                    board, static_cast<int>(type), rotation, x, y, reached ? "reached" : "missed");
+                        failures++;
+                    }
+                    reachableTotal += reached;
+                }
+            }
+        }
+
+        // every placement's moves have to take a real block to it
+        std::array<Placement, Search::MAX_PLACEMENTS> placements;
+        const int count = Search::enumerate(grid.getRows(), type, 0, start, RotationSystems::SRS, placements);
+
+        for (int i = 0; i < count; i++) {
+            const Placement& target = placements[i];
+
+            std::array<BlockMove, Search::MAX_MOVES> moves;
+            const int moveCount = Search::movesFor(grid, type, 0, start, RotationSystems::SRS, target, moves);
+            if (moveCount < 0) {
+                std::printf("board %d: no moves found for a reachable placement\n", board);
+                failures++;
+                continue;
+            }
+
+            // everything but the final hard drop has to actually move the block
+            Block block(start, type, pieceColor(type), &grid);
+            bool moved = true;
+            for (int m = 0; m + 1 < moveCount && moved; m++) {
+                moved = block.moveBlock(moves[m]) == MoveResult::MOVED;
+            }
+
+            const Point position = block.getPosition();
+            const int landing = position.y + grid.dropDistance(pieceShape(type, block.getRotation()), position);
+
+            if (!moved || block.getRotation() != target.rotation || position.x != target.position.x
+                || landing != target.position.y) {
+                std::printf("board %d: moves for rotation %d at (%d, %d) went somewhere else\n",
+                            board, target.rotation, target.position.x, target.position.y);
+                failures++;
+            }
+            pathsPlayed++;
+        }
+    }
+
+    std::printf("%ld reachable positions, %ld paths played, %d failures\n", reachableTotal, pathsPlayed, failures);
+    return failures == 0 ? 0 : 1;
+}
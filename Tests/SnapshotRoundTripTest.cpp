@@ -0,0 +1,151 @@
+//
+// Created by sdalp on 10/17/2026.
+//
+
+// Takes snapshots of the board on every step of random games, loads them into a fresh grid
+// and checks it plays exactly the same. Then packs every piece state, including positions at
+// both ends of the packed range, and checks the block unpacked from it.
+
+#include <array>
+#include <cstdio>
+#include <memory>
+
+#include "Blocks/Block.h"
+#include "Blocks/PackedPiece.h"
+#include "GameManager/BoardSnapshot.h"
+#include "GameManager/GameState.h"
+#include "GameManager/Randomizer.h"
+
+namespace {
+    // rows, colors (if checkColors), hash and the column plane (seen through fits and dropDistance)
+    bool sameGrid(const GameGrid& a, const GameGrid& b, const bool checkColors) {
+        if (a.getHash() != b.getHash()) {
+            return false;
+        }
+
+        for (int y = 0; y < GameGrid::HEIGHT; y++) {
+            if (a.getRow(y) != b.getRow(y)) {
+                return false;
+            }
+            for (int x = 0; x < GameGrid::WIDTH && checkColors; x++) {
+                if (a.getColorAt({x, y}) != b.getColorAt({x, y})) {
+                    return false;
+                }
+            }
+        }
+
+        for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+            for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+                const PieceShape& shape = pieceShape(static_cast<BlockType>(type), rotation);
+                for (int y = -3; y < GameGrid::HEIGHT; y++) {
+                    for (int x = -GameGrid::WALL_BITS; x < GameGrid::WIDTH; x++) {
+                        const bool fits = a.fits(shape, {x, y});
+                        if (fits != b.fits(shape, {x, y})) {
+                            return false;
+                        }
+                        if (fits && a.dropDistance(shape, {x, y}) != b.dropDistance(shape, {x, y})) {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Every step of some games of random moves, grid -> snapshot -> grid with and without colors
+    int checkBoards(const int games) {
+        constexpr std::array moves{BlockMove::LEFT, BlockMove::RIGHT, BlockMove::ROTATE,
+                                   BlockMove::ROTATE_CCW, BlockMove::DOWN, BlockMove::QUICK_DOWN};
+
+        const auto state = std::make_unique<GameState>();
+        Xoshiro256 rng(24);
+        int failures = 0;
+
+        for (int game = 0; game < games; game++) {
+            state->start(game);
+
+            while (!state->isGameOver()) {
+                const BlockMove move = moves[rng.nextBelow(moves.size())];
+                state->step(std::span<const BlockMove>(&move, 1));
+
+                const GameGrid& grid = state->getGrid();
+
+                const auto colored = ColoredBoardSnapshot::fromGrid(grid);
+                GameGrid coloredCopy;
+                colored.toGrid(coloredCopy);
+
+                const auto plain = BoardSnapshot::fromGrid(grid);
+                GameGrid plainCopy;
+                plain.toGrid(plainCopy, BlockColor::RED);
+
+                if (!sameGrid(grid, coloredCopy, true) || !(ColoredBoardSnapshot::fromGrid(coloredCopy) == colored)) {
+                    std::printf("game %d: colored snapshot didn't come back as the same grid\n", game);
+                    failures++;
+                }
+                if (!sameGrid(grid, plainCopy, false) || !(BoardSnapshot::fromGrid(plainCopy) == plain)
+                    || plain.hash() != grid.getHash()) {
+                    std::printf("game %d: plain snapshot didn't come back as the same grid\n", game);
+                    failures++;
+                }
+            }
+        }
+
+        return failures;
+    }
+
+    bool sameCells(const std::array<Point, 4>& a, const std::array<Point, 4>& b) {
+        for (int i = 0; i < 4; i++) {
+            if (a[i].x != b[i].x || a[i].y != b[i].y) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Every type, rotation and color at positions up to the ends of the biased 8 bit fields
+    int checkPieces() {
+        constexpr std::array coordinates{-64, -63, -3, -1, 0, 1, 9, 23, 127, 190, 191};
+
+        GameGrid grid;
+        int failures = 0;
+
+        for (int type = 0; type < PIECE_TYPE_COUNT; type++) {
+            for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+                for (int color = 0; color <= static_cast<int>(BlockColor::ORANGE); color++) {
+                    for (const int x : coordinates) {
+                        for (const int y : coordinates) {
+                            Block block({x, y}, static_cast<BlockType>(type), static_cast<BlockColor>(color), &grid);
+                            block.setRotation(rotation);
+
+                            const PackedPiece packed = PackedPiece::fromBlock(block);
+                            const Block unpacked = PackedPiece::fromRaw(packed.raw()).toBlock(&grid);
+
+                            const bool same = unpacked.getType() == block.getType()
+                                              && unpacked.getRotation() == rotation
+                                              && unpacked.getColor() == block.getColor()
+                                              && unpacked.getPosition().x == x && unpacked.getPosition().y == y
+                                              && sameCells(unpacked.getCurrentPosition(), block.getCurrentPosition())
+                                              && PackedPiece::fromBlock(unpacked) == packed;
+                            if (!same) {
+                                std::printf("piece %d rotation %d color %d at (%d, %d) didn't survive packing\n",
+                                            type, rotation, color, x, y);
+                                failures++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return failures;
+    }
+}
+
+int main() {
+    const int failures = checkBoards(50) + checkPieces();
+
+    std::printf("%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -6,19 +6,21 @@
 #define SIMPLETETRIS_ENUMS_H
 
 #include <array>
+#include <cstdint>
 
 
 enum class BlockType { I, O, T, S, Z, J, L };
 
 enum class BlockMove {
-    ROTATE,
+    ROTATE,      // clockwise
+    ROTATE_CCW,
     LEFT,
     RIGHT,
     DOWN,
     QUICK_DOWN
 };
 
-enum class BlockColor {
+enum class BlockColor : std::uint8_t {
     NONE = 0,
     CYAN,
     YELLOW,
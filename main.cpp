@@ -3,14 +3,32 @@
 //
 
 
+#include <cstdlib>
+#include <string_view>
+
 #include "GameManager/SceneRenderer.h"
 
-int main() {
+int main(int argc, char* argv[]) {
 
     //TODO: Needs nCurses to refresh screen correctly
 
 
     SceneRenderer sceneRenderer;
 
-    sceneRenderer.startGame();
+    // --single-thread runs everything in one fixed timestep loop instead of three threads,
+    // --seed N replays the same pieces and --preview N shows N upcoming pieces
+    GameLoopMode mode = GameLoopMode::THREADED;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg(argv[i]);
+
+        if (arg == "--single-thread") {
+            mode = GameLoopMode::SINGLE_THREADED;
+        } else if (arg == "--seed" && i + 1 < argc) {
+            sceneRenderer.setSeed(std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--preview" && i + 1 < argc) {
+            sceneRenderer.setPreviewCount(std::atoi(argv[++i]));
+        }
+    }
+
+    sceneRenderer.startGame(mode);
 }